@@ -107,6 +107,10 @@ void AstPrinter::Visit(const ExpressionStatement& expression_statement)
 void AstPrinter::Visit(const ReturnStatement& return_statement)
 {
     out_ << Keyword::Return << " ";
+    if (return_statement.is_tail_call)
+    {
+        out_ << Keyword::Tail << " ";
+    }
     return_statement.value->Accept(*this);
 }
 
@@ -125,6 +129,40 @@ void AstPrinter::Visit(const ConditionalStatement& conditional_statement)
     }
 }
 
+void AstPrinter::Visit(const MatchStatement& match_statement)
+{
+    out_ << Keyword::Match << " ";
+    match_statement.subject->Accept(*this);
+    out_ << ":\n";
+
+    for (const auto& match_case : *match_statement.cases)
+    {
+        out_ << Keyword::Case << " ";
+        interleaved_for_each(
+            *match_case->patterns,
+            [&](const auto& pattern)
+            {
+                pattern->value->Accept(*this);
+                if (pattern->end)
+                {
+                    out_ << "..";
+                    pattern->end->Accept(*this);
+                }
+            },
+            [&](const auto&) { out_ << ", "; }
+        );
+        out_ << ":\n";
+        match_case->body->Accept(*this);
+        out_ << "\n";
+    }
+
+    if (match_statement.else_block)
+    {
+        out_ << Keyword::Else << ":\n";
+        match_statement.else_block->Accept(*this);
+    }
+}
+
 void AstPrinter::Visit(const WhileLoop& while_loop)
 {
     out_ << Keyword::While << " ";
@@ -134,6 +172,25 @@ void AstPrinter::Visit(const WhileLoop& while_loop)
     while_loop.body->Accept(*this);
 }
 
+void AstPrinter::Visit(const ForLoop& for_loop)
+{
+    if (for_loop.unroll)
+    {
+        out_ << Keyword::Unroll << " ";
+    }
+    if (for_loop.vectorize)
+    {
+        out_ << Keyword::Vectorize << " ";
+    }
+    out_ << Keyword::For << " " << for_loop.variable << " " << Keyword::In << " ";
+    for_loop.begin->Accept(*this);
+    out_ << "..";
+    for_loop.end->Accept(*this);
+    out_ << ":\n";
+
+    for_loop.body->Accept(*this);
+}
+
 void AstPrinter::Visit(const Deallocation& deallocation)
 {
     out_ << Keyword::Delete << " ";
@@ -175,6 +232,11 @@ void AstPrinter::Visit(const BinaryOp& binary_op)
 void AstPrinter::Visit(const Variable& variable)
 {
     out_ << variable.name;
+    if (variable.type_arguments)
+    {
+        out_ << "::";
+        PrintTypeArguments(*variable.type_arguments);
+    }
 }
 
 void AstPrinter::Visit(const MemberAccessor& member_accessor)
@@ -208,6 +270,11 @@ void AstPrinter::Visit(const IntegerLiteral& literal)
     out_ << literal.value;
 }
 
+void AstPrinter::Visit(const FloatLiteral& literal)
+{
+    out_ << literal.value;
+}
+
 void AstPrinter::Visit(const CharacterLiteral& literal)
 {
     out_ << "'" << sanitize_escape_sequences(static_cast<char>(literal.value)) << "'";
@@ -220,6 +287,30 @@ void AstPrinter::Visit(const StringLiteral& literal)
 
 void AstPrinter::Visit(const Function& function)
 {
+    if (function.inlining == Function::Inlining::Always)
+    {
+        out_ << Keyword::Inline << " ";
+    }
+    else if (function.inlining == Function::Inlining::Never)
+    {
+        out_ << Keyword::NoInline << " ";
+    }
+    if (function.temperature == Function::Temperature::Hot)
+    {
+        out_ << Keyword::Hot << " ";
+    }
+    else if (function.temperature == Function::Temperature::Cold)
+    {
+        out_ << Keyword::Cold << " ";
+    }
+    if (function.is_fast_math)
+    {
+        out_ << Keyword::FastMath << " ";
+    }
+    if (function.is_const)
+    {
+        out_ << Keyword::Constant << " ";
+    }
     out_ << "$";
 
     if (function.captures)
@@ -271,6 +362,10 @@ void AstPrinter::Visit(const Initializer& initializer)
 void AstPrinter::Visit(const Allocation& allocation)
 {
     out_ << Keyword::New;
+    if (allocation.is_uninitialized)
+    {
+        out_ << " " << Keyword::Uninitialized;
+    }
     if (allocation.size)
     {
         out_ << "[";
@@ -303,10 +398,71 @@ void AstPrinter::Visit(const Allocation& allocation)
     out_ << "}";
 }
 
+void AstPrinter::Visit(const Conversion& conversion)
+{
+    out_ << "(";
+    conversion.operand->Accept(*this);
+    out_ << " " << Keyword::As << " ";
+    conversion.annotation->Accept(*this);
+    out_ << ")";
+}
+
+void AstPrinter::Visit(const ElementAccessor& element_accessor)
+{
+    element_accessor.object->Accept(*this);
+    out_ << "[";
+    element_accessor.index->Accept(*this);
+    out_ << "]";
+}
+
+void AstPrinter::Visit(const ArrayLiteral& array_literal)
+{
+    out_ << "[";
+    interleaved_for_each(
+        *array_literal.elements,
+        [&](const auto& element) { element->Accept(*this); },
+        [&](const auto&) { out_ << ", "; }
+    );
+    if (array_literal.repetitions)
+    {
+        out_ << "; " << *array_literal.repetitions;
+    }
+    out_ << "]";
+}
+
+void AstPrinter::Visit(const Slicing& slicing)
+{
+    slicing.object->Accept(*this);
+    out_ << "[";
+    if (slicing.lower)
+    {
+        slicing.lower->Accept(*this);
+    }
+    out_ << "..";
+    if (slicing.upper)
+    {
+        slicing.upper->Accept(*this);
+    }
+    out_ << "]";
+}
+
 void AstPrinter::Visit(const SimpleTypeAnnotation& sta)
 {
     PrintQualifier(sta.mutability);
     out_ << sta.type_name;
+    if (sta.type_arguments)
+    {
+        PrintTypeArguments(*sta.type_arguments);
+    }
+}
+
+void AstPrinter::PrintTypeArguments(const TypeArgumentListAnnotation& type_arguments)
+{
+    out_ << "<";
+    interleaved_for_each(
+        type_arguments, [&](const auto& argument) { argument->Accept(*this); }, [&](const auto&) { out_ << ", "; }
+    );
+    out_ << ">";
 }
 
 void AstPrinter::Visit(const ReferenceTypeAnnotation& rta)
@@ -316,6 +472,20 @@ void AstPrinter::Visit(const ReferenceTypeAnnotation& rta)
     rta.base_type->Accept(*this);
 }
 
+void AstPrinter::Visit(const ArrayTypeAnnotation& ata)
+{
+    PrintQualifier(ata.mutability);
+    out_ << "[" << ata.length << "]";
+    ata.element_type->Accept(*this);
+}
+
+void AstPrinter::Visit(const SliceTypeAnnotation& sta)
+{
+    PrintQualifier(sta.mutability);
+    out_ << "[]";
+    sta.element_type->Accept(*this);
+}
+
 void AstPrinter::Visit(const FunctionTypeAnnotation& fta)
 {
     PrintQualifier(fta.mutability);
@@ -340,6 +510,10 @@ void AstPrinter::Visit(const MutabilityOnlyTypeAnnotation& mota)
 
 void AstPrinter::Visit(const StructExpression& struct_expression)
 {
+    if (struct_expression.is_packed)
+    {
+        out_ << Keyword::Packed << " ";
+    }
     out_ << Keyword::Structure;
     out_ << "\n{\n";
     ++indent_;
@@ -402,6 +576,8 @@ std::string str(UnaryOp::Operator op)
             return "&";
         case UnaryOp::Operator::Caret:
             return "^";
+        case UnaryOp::Operator::Tilde:
+            return "~";
     }
     std::unreachable();
 }
@@ -436,6 +612,16 @@ std::string str(BinaryOp::Operator op)
             return "<=";
         case l0::BinaryOp::Operator::GreaterEquals:
             return ">=";
+        case l0::BinaryOp::Operator::Ampersand:
+            return "&";
+        case l0::BinaryOp::Operator::Pipe:
+            return "|";
+        case l0::BinaryOp::Operator::Tilde:
+            return "~";
+        case l0::BinaryOp::Operator::LessLess:
+            return "<<";
+        case l0::BinaryOp::Operator::GreaterGreater:
+            return ">>";
     }
     std::unreachable();
 }
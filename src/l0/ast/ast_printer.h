@@ -27,7 +27,9 @@ class AstPrinter : IConstExpressionVisitor, IConstStatementVisitor, ITypeAnnotat
     void Visit(const ExpressionStatement& expression_statement) override;
     void Visit(const ReturnStatement& return_statement) override;
     void Visit(const ConditionalStatement& conditional_statement) override;
+    void Visit(const MatchStatement& match_statement) override;
     void Visit(const WhileLoop& while_loop) override;
+    void Visit(const ForLoop& for_loop) override;
     void Visit(const Deallocation& deallocation) override;
 
     void Visit(const Assignment& assignment) override;
@@ -39,14 +41,21 @@ class AstPrinter : IConstExpressionVisitor, IConstStatementVisitor, ITypeAnnotat
     void Visit(const UnitLiteral& literal) override;
     void Visit(const BooleanLiteral& literal) override;
     void Visit(const IntegerLiteral& literal) override;
+    void Visit(const FloatLiteral& literal) override;
     void Visit(const CharacterLiteral& literal) override;
     void Visit(const StringLiteral& literal) override;
     void Visit(const Function& function) override;
     void Visit(const Initializer& initializer) override;
     void Visit(const Allocation& allocation) override;
+    void Visit(const Conversion& conversion) override;
+    void Visit(const ElementAccessor& element_accessor) override;
+    void Visit(const ArrayLiteral& array_literal) override;
+    void Visit(const Slicing& slicing) override;
 
     void Visit(const SimpleTypeAnnotation& sta) override;
     void Visit(const ReferenceTypeAnnotation& rta) override;
+    void Visit(const ArrayTypeAnnotation& ata) override;
+    void Visit(const SliceTypeAnnotation& sta) override;
     void Visit(const FunctionTypeAnnotation& fta) override;
     void Visit(const MethodTypeAnnotation& mta) override;
     void Visit(const MutabilityOnlyTypeAnnotation& mota) override;
@@ -55,6 +64,7 @@ class AstPrinter : IConstExpressionVisitor, IConstStatementVisitor, ITypeAnnotat
     void Visit(const EnumExpression& enum_expression) override;
 
     void PrintQualifier(TypeAnnotationQualifier qualifier, std::string end = " ");
+    void PrintTypeArguments(const TypeArgumentListAnnotation& type_arguments);
 
     std::ostream& out_;
     detail::Indent indent_;
@@ -55,8 +55,9 @@ void BinaryOp::Accept(IExpressionVisitor& visitor)
     visitor.Visit(*this);
 }
 
-Variable::Variable(Identifier name)
-    : name{name}
+Variable::Variable(Identifier name, std::shared_ptr<TypeArgumentListAnnotation> type_arguments)
+    : name{name},
+      type_arguments{type_arguments}
 {
 }
 
@@ -142,6 +143,21 @@ void IntegerLiteral::Accept(IExpressionVisitor& visitor)
     visitor.Visit(*this);
 }
 
+FloatLiteral::FloatLiteral(double value)
+    : value{value}
+{
+}
+
+void FloatLiteral::Accept(IConstExpressionVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
+void FloatLiteral::Accept(IExpressionVisitor& visitor)
+{
+    visitor.Visit(*this);
+}
+
 CharacterLiteral::CharacterLiteral(char8_t value)
     : value{value}
 {
@@ -224,11 +240,13 @@ void Initializer::Accept(IExpressionVisitor& visitor)
 Allocation::Allocation(
     std::shared_ptr<TypeAnnotation> annotation,
     std::shared_ptr<Expression> size,
-    std::shared_ptr<MemberInitializerList> member_initializers
+    std::shared_ptr<MemberInitializerList> member_initializers,
+    bool is_uninitialized
 )
     : annotation{annotation},
       size{size},
-      member_initializers{member_initializers}
+      member_initializers{member_initializers},
+      is_uninitialized{is_uninitialized}
 {
 }
 
@@ -242,4 +260,76 @@ void Allocation::Accept(IExpressionVisitor& visitor)
     visitor.Visit(*this);
 }
 
+Conversion::Conversion(std::shared_ptr<Expression> operand, std::shared_ptr<TypeAnnotation> annotation)
+    : operand{operand},
+      annotation{annotation}
+{
+}
+
+void Conversion::Accept(IConstExpressionVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
+void Conversion::Accept(IExpressionVisitor& visitor)
+{
+    visitor.Visit(*this);
+}
+
+ElementAccessor::ElementAccessor(std::shared_ptr<Expression> object, std::shared_ptr<Expression> index)
+    : object{object},
+      index{index}
+{
+}
+
+void ElementAccessor::Accept(IConstExpressionVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
+void ElementAccessor::Accept(IExpressionVisitor& visitor)
+{
+    visitor.Visit(*this);
+}
+
+ArrayLiteral::ArrayLiteral(std::shared_ptr<ArgumentList> elements, std::optional<std::size_t> repetitions)
+    : elements{elements},
+      repetitions{repetitions}
+{
+}
+
+void ArrayLiteral::Accept(IConstExpressionVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
+void ArrayLiteral::Accept(IExpressionVisitor& visitor)
+{
+    visitor.Visit(*this);
+}
+
+std::size_t ArrayLiteral::GetLength() const
+{
+    return repetitions.value_or(elements->size());
+}
+
+Slicing::Slicing(
+    std::shared_ptr<Expression> object, std::shared_ptr<Expression> lower, std::shared_ptr<Expression> upper
+)
+    : object{object},
+      lower{lower},
+      upper{upper}
+{
+}
+
+void Slicing::Accept(IConstExpressionVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
+void Slicing::Accept(IExpressionVisitor& visitor)
+{
+    visitor.Visit(*this);
+}
+
 }  // namespace l0
@@ -3,12 +3,15 @@
 
 #include <llvm/IR/Intrinsics.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "l0/ast/identifier.h"
 #include "l0/ast/scope.h"
+#include "l0/ast/type_annotation.h"
 #include "l0/types/types.h"
 
 namespace l0
@@ -49,6 +52,7 @@ class UnaryOp : public Expression
         Bang,
         Ampersand,
         Caret,
+        Tilde,
     };
 
     enum class Overload
@@ -56,6 +60,9 @@ class UnaryOp : public Expression
         AddressOf,
         BooleanNegation,
         Dereferenciation,
+        FloatIdentity,
+        FloatNegation,
+        IntegerComplement,
         IntegerNegation,
         IntegerIdentity,
     };
@@ -89,6 +96,11 @@ class BinaryOp : public Expression
         Greater,
         LessEquals,
         GreaterEquals,
+        Ampersand,
+        Pipe,
+        Tilde,
+        LessLess,
+        GreaterGreater,
     };
 
     enum class Overload
@@ -101,7 +113,21 @@ class BinaryOp : public Expression
         CharacterSubtraction,
         CharacterEquality,
         CharacterInequality,
+        FloatAddition,
+        FloatDivision,
+        FloatEquality,
+        FloatGreater,
+        FloatGreaterOrEquals,
+        FloatInequality,
+        FloatLess,
+        FloatLessOrEquals,
+        FloatMultiplication,
+        FloatRemainder,
+        FloatSubtraction,
         IntegerAddition,
+        IntegerBitwiseAnd,
+        IntegerBitwiseOr,
+        IntegerBitwiseXor,
         IntegerDivision,
         IntegerEquality,
         IntegerGreater,
@@ -111,8 +137,17 @@ class BinaryOp : public Expression
         IntegerLessOrEquals,
         IntegerMultiplication,
         IntegerRemainder,
+        IntegerShiftLeft,
+        IntegerShiftRight,
         IntegerSubtraction,
         ReferenceIndexation,
+        UnsignedIntegerDivision,
+        UnsignedIntegerGreater,
+        UnsignedIntegerGreaterOrEquals,
+        UnsignedIntegerLess,
+        UnsignedIntegerLessOrEquals,
+        UnsignedIntegerRemainder,
+        UnsignedIntegerShiftRight,
         EnumMemberEquality,
         EnumMemberInequality
     };
@@ -132,13 +167,16 @@ class BinaryOp : public Expression
 class Variable : public Expression
 {
    public:
-    Variable(Identifier name);
+    Variable(Identifier name, std::shared_ptr<TypeArgumentListAnnotation> type_arguments = nullptr);
 
     void Accept(IConstExpressionVisitor& visitor) const override;
     void Accept(IExpressionVisitor& visitor) override;
 
     Identifier name;
 
+    // explicit type arguments of a generic function, e.g. 'max::<I64>'
+    std::shared_ptr<TypeArgumentListAnnotation> type_arguments;
+
     mutable std::shared_ptr<Scope> scope;
     mutable Identifier resolved_name;
 };
@@ -158,6 +196,19 @@ class MemberAccessor : public Expression
     mutable std::shared_ptr<Scope> dereferenced_object_type_scope;
     mutable std::optional<std::size_t> nonstatic_member_index;
     mutable std::shared_ptr<Expression> dereferenced_object;
+
+    // builtin members are the length 'len' of arrays, slices and vectors, and the lane-wise reductions of vectors
+    enum class BuiltinMember
+    {
+        Length,
+        Sum,
+        Product,
+        Minimum,
+        Maximum,
+        Any,
+        All,
+    };
+    mutable std::optional<BuiltinMember> builtin_member;
 };
 
 using ArgumentList = std::vector<std::shared_ptr<Expression>>;
@@ -205,6 +256,17 @@ class IntegerLiteral : public Expression
     std::int64_t value;
 };
 
+class FloatLiteral : public Expression
+{
+   public:
+    FloatLiteral(double value);
+
+    void Accept(IConstExpressionVisitor& visitor) const override;
+    void Accept(IExpressionVisitor& visitor) override;
+
+    double value;
+};
+
 class CharacterLiteral : public Expression
 {
    public:
@@ -245,6 +307,20 @@ using CaptureList = std::vector<std::shared_ptr<Variable>>;
 class Function : public Expression
 {
    public:
+    enum class Inlining
+    {
+        Default,
+        Always,
+        Never,
+    };
+
+    enum class Temperature
+    {
+        Default,
+        Hot,
+        Cold,
+    };
+
     Function(
         std::shared_ptr<ParameterDeclarationList> parameters,
         std::shared_ptr<CaptureList> captures,
@@ -261,9 +337,14 @@ class Function : public Expression
     std::shared_ptr<TypeAnnotation> return_type_annotation;
     std::shared_ptr<StatementBlock> body;
     Identifier namespace_;
+    bool is_const{false};
+    Inlining inlining{Inlining::Default};
+    Temperature temperature{Temperature::Default};
+    bool is_fast_math{false};
 
     mutable std::shared_ptr<Scope> locals = std::make_shared<Scope>();
     mutable std::optional<std::string> global_name{};
+    mutable bool context_may_escape{true};
 };
 
 struct MemberInitializer
@@ -293,7 +374,8 @@ class Allocation : public Expression
     Allocation(
         std::shared_ptr<TypeAnnotation> annotation,
         std::shared_ptr<Expression> size,
-        std::shared_ptr<MemberInitializerList> member_initializers = nullptr
+        std::shared_ptr<MemberInitializerList> member_initializers = nullptr,
+        bool is_uninitialized = false
     );
 
     void Accept(IConstExpressionVisitor& visitor) const override;
@@ -302,11 +384,80 @@ class Allocation : public Expression
     std::shared_ptr<TypeAnnotation> annotation;
     std::shared_ptr<Expression> size;
     std::shared_ptr<MemberInitializerList> member_initializers;
+    bool is_uninitialized;
 
     mutable std::shared_ptr<Type> allocated_type;
     mutable std::shared_ptr<Expression> initial_value;
 };
 
+class Conversion : public Expression
+{
+   public:
+    Conversion(std::shared_ptr<Expression> operand, std::shared_ptr<TypeAnnotation> annotation);
+
+    void Accept(IConstExpressionVisitor& visitor) const override;
+    void Accept(IExpressionVisitor& visitor) override;
+
+    std::shared_ptr<Expression> operand;
+    std::shared_ptr<TypeAnnotation> annotation;
+};
+
+class ElementAccessor : public Expression
+{
+   public:
+    ElementAccessor(std::shared_ptr<Expression> object, std::shared_ptr<Expression> index);
+
+    void Accept(IConstExpressionVisitor& visitor) const override;
+    void Accept(IExpressionVisitor& visitor) override;
+
+    std::shared_ptr<Expression> object;
+    std::shared_ptr<Expression> index;
+
+    mutable std::shared_ptr<Expression> dereferenced_object{};
+    mutable std::shared_ptr<Type> dereferenced_object_type{};
+
+    // cleared by the bounds check elimination if the index is proven to be in range
+    mutable bool needs_bounds_check{true};
+
+    // the lanes selected by indexing a vector with an array literal, which shuffles them into a new vector
+    mutable std::optional<std::vector<int>> shuffle_mask{};
+};
+
+// Creates a slice of an array, of another slice, or of the memory a reference points to. Omitted bounds default to
+// the start and end of the array or slice; both bounds are required for references.
+class Slicing : public Expression
+{
+   public:
+    Slicing(std::shared_ptr<Expression> object, std::shared_ptr<Expression> lower, std::shared_ptr<Expression> upper);
+
+    void Accept(IConstExpressionVisitor& visitor) const override;
+    void Accept(IExpressionVisitor& visitor) override;
+
+    std::shared_ptr<Expression> object;
+    std::shared_ptr<Expression> lower;
+    std::shared_ptr<Expression> upper;
+
+    mutable std::shared_ptr<Expression> dereferenced_object{};
+    mutable std::shared_ptr<Type> dereferenced_object_type{};
+
+    mutable bool needs_bounds_check{true};
+};
+
+class ArrayLiteral : public Expression
+{
+   public:
+    ArrayLiteral(std::shared_ptr<ArgumentList> elements, std::optional<std::size_t> repetitions = std::nullopt);
+
+    void Accept(IConstExpressionVisitor& visitor) const override;
+    void Accept(IExpressionVisitor& visitor) override;
+
+    // In the form '[value; N]', the single element is repeated N times.
+    std::shared_ptr<ArgumentList> elements;
+    std::optional<std::size_t> repetitions;
+
+    std::size_t GetLength() const;
+};
+
 class IConstExpressionVisitor
 {
    public:
@@ -321,11 +472,16 @@ class IConstExpressionVisitor
     virtual void Visit(const UnitLiteral& literal) = 0;
     virtual void Visit(const BooleanLiteral& literal) = 0;
     virtual void Visit(const IntegerLiteral& literal) = 0;
+    virtual void Visit(const FloatLiteral& literal) = 0;
     virtual void Visit(const CharacterLiteral& literal) = 0;
     virtual void Visit(const StringLiteral& literal) = 0;
     virtual void Visit(const Function& function) = 0;
     virtual void Visit(const Initializer& initializer) = 0;
     virtual void Visit(const Allocation& allocation) = 0;
+    virtual void Visit(const Conversion& conversion) = 0;
+    virtual void Visit(const ElementAccessor& element_accessor) = 0;
+    virtual void Visit(const ArrayLiteral& array_literal) = 0;
+    virtual void Visit(const Slicing& slicing) = 0;
 };
 
 class IExpressionVisitor
@@ -342,11 +498,16 @@ class IExpressionVisitor
     virtual void Visit(UnitLiteral& literal) = 0;
     virtual void Visit(BooleanLiteral& literal) = 0;
     virtual void Visit(IntegerLiteral& literal) = 0;
+    virtual void Visit(FloatLiteral& literal) = 0;
     virtual void Visit(CharacterLiteral& literal) = 0;
     virtual void Visit(StringLiteral& literal) = 0;
     virtual void Visit(Function& function) = 0;
     virtual void Visit(Initializer& initializer) = 0;
     virtual void Visit(Allocation& allocation) = 0;
+    virtual void Visit(Conversion& conversion) = 0;
+    virtual void Visit(ElementAccessor& element_accessor) = 0;
+    virtual void Visit(ArrayLiteral& array_literal) = 0;
+    virtual void Visit(Slicing& slicing) = 0;
 };
 
 }  // namespace l0
@@ -28,11 +28,6 @@ Identifier::Identifier(std::vector<std::string> parts)
 {
 }
 
-std::string Identifier::last() const
-{
-    return parts.back();
-}
-
 std::string Identifier::ToString() const
 {
     std::stringstream ss{};
@@ -46,6 +41,21 @@ Identifier Identifier::GetPrefix() const
     return Identifier{prefix};
 }
 
+std::string Identifier::GetLast() const
+{
+    return parts.back();
+}
+
+std::size_t Identifier::Hash() const noexcept
+{
+    std::size_t result = parts.size();
+    for (const auto& part : parts)
+    {
+        result ^= std::hash<std::string>()(part) + 0x9e3779b97f4a7c15 + (result << 6) + (result >> 2);
+    }
+    return result;
+}
+
 bool Identifier::operator==(const Identifier& other) const
 {
     return this->parts == other.parts;
@@ -18,6 +18,8 @@ class Identifier
 
     std::string ToString() const;
     Identifier GetPrefix() const;
+    std::string GetLast() const;
+    std::size_t Hash() const noexcept;
 
     bool operator==(const Identifier& other) const;
     Identifier& operator+=(const Identifier& other);
@@ -26,8 +28,6 @@ class Identifier
     friend std::ostream& operator<<(std::ostream& stream, const Identifier& identifier);
 
    private:
-    std::string last() const;
-
     std::vector<std::string> parts{};
 };
 
@@ -38,9 +38,9 @@ std::ostream& operator<<(std::ostream& stream, const Identifier& identifier);
 template <>
 struct std::hash<l0::Identifier>
 {
-    std::size_t operator()(const l0::Identifier& identifier) const
+    std::size_t operator()(const l0::Identifier& identifier) const noexcept
     {
-        return std::hash<std::string>()(identifier.ToString());
+        return identifier.Hash();
     }
 };
 
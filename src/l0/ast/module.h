@@ -4,7 +4,10 @@
 #include <llvm/IR/Module.h>
 
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <unordered_map>
+#include <variant>
 
 #include "l0/ast/expression.h"
 #include "l0/ast/scope.h"
@@ -13,6 +16,29 @@
 namespace l0
 {
 
+// A function or struct declared with type parameters, e.g. 'fn max<T> (...)' or 'struct Pair<T> {...}'. It is kept in
+// source form and instantiated for each list of type arguments it is used with.
+struct GenericDeclaration
+{
+    using Instance = std::variant<std::shared_ptr<Declaration>, std::shared_ptr<TypeDeclaration>>;
+
+    Identifier identifier;
+    std::vector<std::string> type_parameters;
+
+    // the declaration with its type parameters left unresolved, for inferring the type arguments of calls
+    Instance definition;
+
+    // parses the declaration anew under the given name, with each type parameter replaced by its type argument
+    std::function<Instance(const std::string& name, const std::vector<std::shared_ptr<Type>>& type_arguments)>
+        instantiate;
+};
+
+struct GenericInstance
+{
+    Identifier generic;
+    std::vector<std::shared_ptr<Type>> type_arguments;
+};
+
 struct Module
 {
     std::string name;
@@ -26,6 +52,14 @@ struct Module
     std::vector<std::shared_ptr<Declaration>> global_declarations{};
     std::vector<std::shared_ptr<TypeDeclaration>> global_type_declarations{};
 
+    // Functions and methods of other modules that are marked 'inline', by their name in the externals scope
+    std::unordered_map<Identifier, std::shared_ptr<Function>> inline_externals{};
+
+    // Generics of this and all other modules, and the instances of them created for this module, by their name
+    std::unordered_map<Identifier, std::shared_ptr<GenericDeclaration>> generics{};
+    std::unordered_map<Identifier, GenericInstance> generic_instances{};
+    bool are_local_scopes_resolved{false};
+
     llvm::Module* intermediate_representation{nullptr};
 };
 
@@ -1,5 +1,8 @@
 #include "l0/ast/scope.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace l0
 {
 
@@ -10,7 +13,7 @@ void Scope::DeclareVariable(Identifier identifier)
         throw ScopeError(std::format("Variable was '{}' declared before.", identifier.ToString()));
     }
 
-    variables_.insert(identifier);
+    FindOrInsert(identifier).is_variable_declared = true;
 }
 
 void Scope::DeclareVariable(Identifier identifier, std::shared_ptr<Type> type)
@@ -21,72 +24,90 @@ void Scope::DeclareVariable(Identifier identifier, std::shared_ptr<Type> type)
 
 bool Scope::IsVariableDeclared(Identifier identifier) const
 {
-    return variables_.contains(identifier);
+    auto entry = Find(identifier);
+    return entry && entry->is_variable_declared;
 }
 
 void Scope::SetVariableType(Identifier identifier, std::shared_ptr<Type> type)
 {
-    if (!IsVariableDeclared(identifier))
+    auto entry = Find(identifier);
+    if (!entry || !entry->is_variable_declared)
     {
         throw ScopeError(std::format("Cannot set type of undeclared variable '{}'.", identifier.ToString()));
     }
 
-    if (IsVariableTypeSet(identifier))
+    if (entry->variable_type)
     {
         throw ScopeError(std::format("Type of variable '{}' was set before.", identifier.ToString()));
     }
 
-    variable_types_.insert(std::make_pair(identifier, type));
+    entry->variable_type = type;
 }
 
 bool Scope::IsVariableTypeSet(Identifier identifier) const
 {
-    return variable_types_.contains(identifier);
+    auto entry = Find(identifier);
+    return entry && entry->is_variable_declared && entry->variable_type;
 }
 
 std::shared_ptr<Type> Scope::GetVariableType(Identifier identifier) const
 {
-    if (!IsVariableDeclared(identifier))
+    auto entry = Find(identifier);
+    if (!entry || !entry->is_variable_declared)
     {
         throw ScopeError(std::format("Cannot get type of undeclared variable '{}'.", identifier.ToString()));
     }
 
-    if (!IsVariableTypeSet(identifier))
+    if (!entry->variable_type)
     {
         throw ScopeError(std::format("Type of variable '{}' is undefined.", identifier.ToString()));
     }
 
-    return variable_types_.at(identifier);
+    return entry->variable_type;
 }
 
-void Scope::SetLLVMValue(Identifier identifier, llvm::Value* llvm_value)
+void Scope::SetLLVMValue(Identifier identifier, llvm::Value* llvm_value, bool is_address)
 {
-    if (!IsVariableDeclared(identifier))
+    auto entry = Find(identifier);
+    if (!entry || !entry->is_variable_declared)
     {
         throw ScopeError(std::format("Cannot set LLVM Value of undeclared variable '{}'.", identifier.ToString()));
     }
 
-    if (llvm_values_.contains(identifier))
+    if (entry->llvm_value)
     {
         throw ScopeError(std::format("LLVM Value of variable '{}' was set before.", identifier.ToString()));
     }
 
-    llvm_values_.insert({identifier, llvm_value});
+    entry->llvm_value = llvm_value;
+    entry->is_llvm_value_address = is_address;
 }
 
 llvm::Value* Scope::GetLLVMValue(Identifier identifier) const
 {
-    if (!IsVariableDeclared(identifier))
+    auto entry = Find(identifier);
+    if (!entry || !entry->is_variable_declared)
     {
         throw ScopeError(std::format("Cannot get LLVM Value of undeclared variable '{}'.", identifier.ToString()));
     }
 
-    if (!llvm_values_.contains(identifier))
+    if (!entry->llvm_value)
     {
         throw ScopeError(std::format("LLVM Value of variable '{}' is undefined.", identifier.ToString()));
     }
 
-    return llvm_values_.at(identifier);
+    return entry->llvm_value;
+}
+
+bool Scope::IsLLVMValueAddress(Identifier identifier) const
+{
+    auto entry = Find(identifier);
+    if (!entry || !entry->is_variable_declared)
+    {
+        throw ScopeError(std::format("Cannot get LLVM Value of undeclared variable '{}'.", identifier.ToString()));
+    }
+
+    return entry->is_llvm_value_address;
 }
 
 void Scope::DeclareType(Identifier identifier)
@@ -96,75 +117,175 @@ void Scope::DeclareType(Identifier identifier)
         throw ScopeError(std::format("Type '{}' was declared before.", identifier.ToString()));
     }
 
-    types_.insert(identifier);
+    FindOrInsert(identifier).is_type_declared = true;
 }
 
 bool Scope::IsTypeDeclared(Identifier identifier) const
 {
-    return types_.contains(identifier);
+    auto entry = Find(identifier);
+    return entry && entry->is_type_declared;
 }
 
 void Scope::DefineType(Identifier identifier, std::shared_ptr<Type> type)
 {
-    if (!IsTypeDeclared(identifier))
+    auto entry = Find(identifier);
+    if (!entry || !entry->is_type_declared)
     {
         throw ScopeError(std::format("Type '{}' is undefined.", identifier.ToString()));
     }
 
-    if (IsTypeDefined(identifier))
+    if (entry->type_definition)
     {
         throw ScopeError(std::format("Type '{}' was defined before.", identifier.ToString()));
     }
 
-    type_definitions_.insert({identifier, type});
+    entry->type_definition = type;
 }
 
 bool Scope::IsTypeDefined(Identifier identifier) const
 {
-    return type_definitions_.contains(identifier);
+    auto entry = Find(identifier);
+    return entry && entry->is_type_declared && entry->type_definition;
 }
 
 std::shared_ptr<Type> Scope::GetTypeDefinition(Identifier identifier) const
 {
-    if (!IsTypeDefined(identifier))
+    auto entry = Find(identifier);
+    if (!entry || !entry->is_type_declared || !entry->type_definition)
     {
         throw ScopeError(std::format("Type '{}' is undefined.", identifier.ToString()));
     }
 
-    return type_definitions_.at(identifier);
+    return entry->type_definition;
 }
 
 void Scope::Clear()
 {
-    llvm_values_.clear();
-    types_.clear();
-    variables_.clear();
+    entries_.clear();
+    index_.clear();
 }
 
-const std::unordered_set<Identifier>& Scope::GetVariables() const
+std::vector<Identifier> Scope::GetVariables() const
 {
-    return variables_;
+    std::vector<Identifier> variables;
+    for (const auto& entry : entries_)
+    {
+        if (entry.is_variable_declared)
+        {
+            variables.push_back(entry.identifier);
+        }
+    }
+    return variables;
 }
 
-const std::unordered_set<Identifier>& Scope::GetTypes() const
+std::vector<Identifier> Scope::GetTypes() const
 {
-    return types_;
+    std::vector<Identifier> types;
+    for (const auto& entry : entries_)
+    {
+        if (entry.is_type_declared)
+        {
+            types.push_back(entry.identifier);
+        }
+    }
+    return types;
 }
 
 void Scope::UpdateTypes(const Scope& other)
 {
-    for (const auto& [identifier, definition] : other.type_definitions_)
+    for (const auto& entry : other.entries_)
     {
-        DeclareType(identifier);
-        DefineType(identifier, definition);
+        if (entry.is_type_declared && entry.type_definition)
+        {
+            DeclareType(entry.identifier);
+            DefineType(entry.identifier, entry.type_definition);
+        }
     }
 }
 
 void Scope::UpdateVariables(const Scope& other)
 {
-    for (const auto& [identifier, type] : other.variable_types_)
+    for (const auto& entry : other.entries_)
+    {
+        if (entry.is_variable_declared && entry.variable_type)
+        {
+            DeclareVariable(entry.identifier, entry.variable_type);
+        }
+    }
+}
+
+const Scope::Entry* Scope::Find(const Identifier& identifier) const
+{
+    auto hash = identifier.Hash();
+
+    if (index_.empty())
+    {
+        for (const auto& entry : entries_)
+        {
+            if (entry.hash == hash && entry.identifier == identifier)
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    auto mask = index_.size() - 1;
+    for (auto slot = hash & mask; index_[slot] != 0; slot = (slot + 1) & mask)
+    {
+        const auto& entry = entries_[index_[slot] - 1];
+        if (entry.hash == hash && entry.identifier == identifier)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+Scope::Entry* Scope::Find(const Identifier& identifier)
+{
+    return const_cast<Entry*>(std::as_const(*this).Find(identifier));
+}
+
+Scope::Entry& Scope::FindOrInsert(const Identifier& identifier)
+{
+    if (auto entry = Find(identifier))
+    {
+        return *entry;
+    }
+
+    entries_.push_back({.identifier = identifier, .hash = identifier.Hash()});
+
+    if (entries_.size() > kMaxLinearEntries && 2 * entries_.size() > index_.size())
+    {
+        Reindex(std::max<std::size_t>(4 * kMaxLinearEntries, 2 * index_.size()));
+    }
+    else if (!index_.empty())
+    {
+        auto mask = index_.size() - 1;
+        auto slot = entries_.back().hash & mask;
+        while (index_[slot] != 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        index_[slot] = static_cast<std::uint32_t>(entries_.size());
+    }
+
+    return entries_.back();
+}
+
+void Scope::Reindex(std::size_t capacity)
+{
+    index_.assign(capacity, 0);
+    auto mask = capacity - 1;
+    for (std::size_t i = 0; i < entries_.size(); ++i)
     {
-        DeclareVariable(identifier, type);
+        auto slot = entries_[i].hash & mask;
+        while (index_[slot] != 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        index_[slot] = static_cast<std::uint32_t>(i + 1);
     }
 }
 
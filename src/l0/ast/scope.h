@@ -3,9 +3,9 @@
 
 #include <llvm/IR/Value.h>
 
+#include <cstdint>
 #include <memory>
-#include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 #include "l0/ast/identifier.h"
 #include "l0/types/types.h"
@@ -24,8 +24,9 @@ class Scope
     bool IsVariableTypeSet(Identifier identifier) const;
     std::shared_ptr<Type> GetVariableType(Identifier identifier) const;
 
-    void SetLLVMValue(Identifier identifier, llvm::Value* llvm_value);
+    void SetLLVMValue(Identifier identifier, llvm::Value* llvm_value, bool is_address = true);
     llvm::Value* GetLLVMValue(Identifier identifier) const;
+    bool IsLLVMValueAddress(Identifier identifier) const;
 
     void DeclareType(Identifier identifier);
     bool IsTypeDeclared(Identifier identifier) const;
@@ -34,19 +35,38 @@ class Scope
     std::shared_ptr<Type> GetTypeDefinition(Identifier identifier) const;
 
     void Clear();
-    const std::unordered_set<Identifier>& GetVariables() const;
-    const std::unordered_set<Identifier>& GetTypes() const;
+    std::vector<Identifier> GetVariables() const;
+    std::vector<Identifier> GetTypes() const;
 
     void UpdateTypes(const Scope& other);
     void UpdateVariables(const Scope& other);
 
    private:
-    std::unordered_set<Identifier> variables_;
-    std::unordered_map<Identifier, std::shared_ptr<Type>> variable_types_;
-    std::unordered_map<Identifier, llvm::Value*> llvm_values_;
-
-    std::unordered_set<Identifier> types_;
-    std::unordered_map<Identifier, std::shared_ptr<Type>> type_definitions_;
+    struct Entry
+    {
+        Identifier identifier;
+        std::size_t hash;
+
+        bool is_variable_declared{false};
+        std::shared_ptr<Type> variable_type{};
+        llvm::Value* llvm_value{nullptr};
+        bool is_llvm_value_address{true};
+
+        bool is_type_declared{false};
+        std::shared_ptr<Type> type_definition{};
+    };
+
+    // Entries are kept in declaration order. Small (typically local) scopes are searched linearly; once a scope grows
+    // beyond kMaxLinearEntries, an open-addressing index of entry positions is maintained alongside.
+    static constexpr std::size_t kMaxLinearEntries = 8;
+
+    std::vector<Entry> entries_;
+    std::vector<std::uint32_t> index_;
+
+    const Entry* Find(const Identifier& identifier) const;
+    Entry* Find(const Identifier& identifier);
+    Entry& FindOrInsert(const Identifier& identifier);
+    void Reindex(std::size_t capacity);
 };
 
 class ScopeError
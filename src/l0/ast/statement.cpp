@@ -73,8 +73,9 @@ void ExpressionStatement::Accept(IStatementVisitor& visitor)
     visitor.Visit(*this);
 }
 
-ReturnStatement::ReturnStatement(std::shared_ptr<Expression> value)
-    : value{value}
+ReturnStatement::ReturnStatement(std::shared_ptr<Expression> value, bool is_tail_call)
+    : value{value},
+      is_tail_call{is_tail_call}
 {
 }
 
@@ -109,6 +110,27 @@ void ConditionalStatement::Accept(IStatementVisitor& visitor)
     visitor.Visit(*this);
 }
 
+MatchStatement::MatchStatement(
+    std::shared_ptr<Expression> subject,
+    std::shared_ptr<MatchCaseList> cases,
+    std::shared_ptr<StatementBlock> else_block
+)
+    : subject{subject},
+      cases{cases},
+      else_block{else_block}
+{
+}
+
+void MatchStatement::Accept(IConstStatementVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
+void MatchStatement::Accept(IStatementVisitor& visitor)
+{
+    visitor.Visit(*this);
+}
+
 WhileLoop::WhileLoop(std::shared_ptr<Expression> condition, std::shared_ptr<StatementBlock> body)
     : condition{condition},
       body{body}
@@ -125,6 +147,29 @@ void WhileLoop::Accept(IStatementVisitor& visitor)
     visitor.Visit(*this);
 }
 
+ForLoop::ForLoop(
+    std::string variable,
+    std::shared_ptr<Expression> begin,
+    std::shared_ptr<Expression> end,
+    std::shared_ptr<StatementBlock> body
+)
+    : variable{variable},
+      begin{begin},
+      end{end},
+      body{body}
+{
+}
+
+void ForLoop::Accept(IConstStatementVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
+void ForLoop::Accept(IStatementVisitor& visitor)
+{
+    visitor.Visit(*this);
+}
+
 Deallocation::Deallocation(std::shared_ptr<Expression> reference)
     : reference{reference}
 {
@@ -1,6 +1,7 @@
 #ifndef L0_AST_STATEMENT_H
 #define L0_AST_STATEMENT_H
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -80,12 +81,13 @@ class ExpressionStatement : public Statement
 class ReturnStatement : public Statement
 {
    public:
-    ReturnStatement(std::shared_ptr<Expression> value);
+    ReturnStatement(std::shared_ptr<Expression> value, bool is_tail_call = false);
 
     void Accept(IConstStatementVisitor& visitor) const override;
     void Accept(IStatementVisitor& visitor) override;
 
     std::shared_ptr<Expression> value;
+    bool is_tail_call;
 };
 
 class ConditionalStatement : public Statement
@@ -108,6 +110,46 @@ class ConditionalStatement : public Statement
     bool else_block_returns{false};
 };
 
+struct MatchPattern
+{
+    std::shared_ptr<Expression> value;
+    // exclusive upper bound if the pattern is a range 'value..end'
+    std::shared_ptr<Expression> end;
+
+    // inclusive bounds of the matched values, as determined by the typechecker
+    mutable std::int64_t lower{0};
+    mutable std::int64_t upper{0};
+};
+using MatchPatternList = std::vector<std::shared_ptr<MatchPattern>>;
+
+struct MatchCase
+{
+    std::shared_ptr<MatchPatternList> patterns;
+    std::shared_ptr<StatementBlock> body;
+
+    bool body_returns{false};
+};
+using MatchCaseList = std::vector<std::shared_ptr<MatchCase>>;
+
+class MatchStatement : public Statement
+{
+   public:
+    MatchStatement(
+        std::shared_ptr<Expression> subject,
+        std::shared_ptr<MatchCaseList> cases,
+        std::shared_ptr<StatementBlock> else_block = nullptr
+    );
+
+    void Accept(IConstStatementVisitor& visitor) const override;
+    void Accept(IStatementVisitor& visitor) override;
+
+    std::shared_ptr<Expression> subject;
+    std::shared_ptr<MatchCaseList> cases;
+    std::shared_ptr<StatementBlock> else_block;
+
+    bool else_block_returns{false};
+};
+
 class WhileLoop : public Statement
 {
    public:
@@ -120,6 +162,33 @@ class WhileLoop : public Statement
     std::shared_ptr<StatementBlock> body;
 };
 
+class ForLoop : public Statement
+{
+   public:
+    ForLoop(
+        std::string variable,
+        std::shared_ptr<Expression> begin,
+        std::shared_ptr<Expression> end,
+        std::shared_ptr<StatementBlock> body
+    );
+
+    void Accept(IConstStatementVisitor& visitor) const override;
+    void Accept(IStatementVisitor& visitor) override;
+
+    // the loop variable runs from begin (inclusive) to end (exclusive); both bounds are evaluated once
+    std::string variable;
+    std::shared_ptr<Expression> begin;
+    std::shared_ptr<Expression> end;
+    std::shared_ptr<StatementBlock> body;
+
+    // hints to the optimizer, emitted as loop metadata
+    bool unroll{false};
+    bool vectorize{false};
+
+    // the scope declaring the loop variable, as determined by the resolver
+    mutable std::shared_ptr<Scope> scope;
+};
+
 class Deallocation : public Statement
 {
    public:
@@ -150,7 +219,9 @@ class IConstStatementVisitor
     virtual void Visit(const ExpressionStatement& expression_statement) = 0;
     virtual void Visit(const ReturnStatement& return_statement) = 0;
     virtual void Visit(const ConditionalStatement& conditional_statement) = 0;
+    virtual void Visit(const MatchStatement& match_statement) = 0;
     virtual void Visit(const WhileLoop& while_loop) = 0;
+    virtual void Visit(const ForLoop& for_loop) = 0;
     virtual void Visit(const Deallocation& deallocation) = 0;
 };
 
@@ -165,7 +236,9 @@ class IStatementVisitor
     virtual void Visit(ExpressionStatement& expression_statement) = 0;
     virtual void Visit(ReturnStatement& return_statement) = 0;
     virtual void Visit(ConditionalStatement& conditional_statement) = 0;
+    virtual void Visit(MatchStatement& match_statement) = 0;
     virtual void Visit(WhileLoop& while_loop) = 0;
+    virtual void Visit(ForLoop& for_loop) = 0;
     virtual void Visit(Deallocation& deallocation) = 0;
 };
 
@@ -3,8 +3,11 @@
 namespace l0
 {
 
-SimpleTypeAnnotation::SimpleTypeAnnotation(Identifier type_name)
-    : type_name{type_name}
+SimpleTypeAnnotation::SimpleTypeAnnotation(
+    Identifier type_name, std::shared_ptr<TypeArgumentListAnnotation> type_arguments
+)
+    : type_name{type_name},
+      type_arguments{type_arguments}
 {
 }
 
@@ -23,6 +26,27 @@ void ReferenceTypeAnnotation::Accept(ITypeAnnotationVisitor& visitor) const
     visitor.Visit(*this);
 }
 
+ArrayTypeAnnotation::ArrayTypeAnnotation(std::shared_ptr<TypeAnnotation> element_type, std::size_t length)
+    : element_type{element_type},
+      length{length}
+{
+}
+
+void ArrayTypeAnnotation::Accept(ITypeAnnotationVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
+SliceTypeAnnotation::SliceTypeAnnotation(std::shared_ptr<TypeAnnotation> element_type)
+    : element_type{element_type}
+{
+}
+
+void SliceTypeAnnotation::Accept(ITypeAnnotationVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
 FunctionTypeAnnotation::FunctionTypeAnnotation(
     std::shared_ptr<ParameterListAnnotation> parameters, std::shared_ptr<TypeAnnotation> return_type
 )
@@ -1,6 +1,7 @@
 #ifndef L0_AST_TYPE_ANNOTATION_H
 #define L0_AST_TYPE_ANNOTATION_H
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -28,14 +29,21 @@ class TypeAnnotation
     TypeAnnotationQualifier mutability{TypeAnnotationQualifier::None};
 };
 
+using TypeArgumentListAnnotation = std::vector<std::shared_ptr<TypeAnnotation>>;
+
 class SimpleTypeAnnotation : public TypeAnnotation
 {
    public:
-    SimpleTypeAnnotation(Identifier type_name);
+    SimpleTypeAnnotation(
+        Identifier type_name, std::shared_ptr<TypeArgumentListAnnotation> type_arguments = nullptr
+    );
 
     void Accept(ITypeAnnotationVisitor& visitor) const override;
 
     Identifier type_name;
+
+    // set for instances of generic structs, e.g. 'Pair<I64>'
+    std::shared_ptr<TypeArgumentListAnnotation> type_arguments;
 };
 
 class ReferenceTypeAnnotation : public TypeAnnotation
@@ -48,6 +56,27 @@ class ReferenceTypeAnnotation : public TypeAnnotation
     std::shared_ptr<TypeAnnotation> base_type;
 };
 
+class ArrayTypeAnnotation : public TypeAnnotation
+{
+   public:
+    ArrayTypeAnnotation(std::shared_ptr<TypeAnnotation> element_type, std::size_t length);
+
+    void Accept(ITypeAnnotationVisitor& visitor) const override;
+
+    std::shared_ptr<TypeAnnotation> element_type;
+    std::size_t length;
+};
+
+class SliceTypeAnnotation : public TypeAnnotation
+{
+   public:
+    SliceTypeAnnotation(std::shared_ptr<TypeAnnotation> element_type);
+
+    void Accept(ITypeAnnotationVisitor& visitor) const override;
+
+    std::shared_ptr<TypeAnnotation> element_type;
+};
+
 using ParameterListAnnotation = std::vector<std::shared_ptr<TypeAnnotation>>;
 
 class FunctionTypeAnnotation : public TypeAnnotation
@@ -85,6 +114,8 @@ class ITypeAnnotationVisitor
 
     virtual void Visit(const SimpleTypeAnnotation& sta) = 0;
     virtual void Visit(const ReferenceTypeAnnotation& rta) = 0;
+    virtual void Visit(const ArrayTypeAnnotation& ata) = 0;
+    virtual void Visit(const SliceTypeAnnotation& sta) = 0;
     virtual void Visit(const FunctionTypeAnnotation& fta) = 0;
     virtual void Visit(const MethodTypeAnnotation& mta) = 0;
     virtual void Visit(const MutabilityOnlyTypeAnnotation& mota) = 0;
@@ -3,8 +3,9 @@
 namespace l0
 {
 
-StructExpression::StructExpression(std::shared_ptr<StructMemberDeclarationList> members)
-    : members{members}
+StructExpression::StructExpression(std::shared_ptr<StructMemberDeclarationList> members, bool is_packed)
+    : members{members},
+      is_packed{is_packed}
 {
 }
 
@@ -25,12 +25,13 @@ using StructMemberDeclarationList = std::vector<std::shared_ptr<Declaration>>;
 class StructExpression : public TypeExpression
 {
    public:
-    StructExpression(std::shared_ptr<StructMemberDeclarationList> members);
+    StructExpression(std::shared_ptr<StructMemberDeclarationList> members, bool is_packed = false);
 
     void Accept(IConstTypeExpressionVisitor& visitor) const override;
     void Accept(ITypeExpressionVisitor& visitor) override;
 
     std::shared_ptr<StructMemberDeclarationList> members;
+    bool is_packed;
 };
 
 struct EnumMemberDeclaration
@@ -8,22 +8,37 @@
 namespace l0::Keyword
 {
 
+constexpr std::string_view As{"as"};
+constexpr std::string_view Case{"case"};
+constexpr std::string_view Cold{"cold"};
 constexpr std::string_view Constant{"const"};
 constexpr std::string_view Delete{"delete"};
 constexpr std::string_view Else{"else"};
 constexpr std::string_view Enumeration{"enum"};
 constexpr std::string_view False{"false"};
+constexpr std::string_view FastMath{"fastmath"};
+constexpr std::string_view For{"for"};
 constexpr std::string_view Function{"fn"};
+constexpr std::string_view Hot{"hot"};
 constexpr std::string_view If{"if"};
+constexpr std::string_view In{"in"};
+constexpr std::string_view Inline{"inline"};
+constexpr std::string_view Match{"match"};
 constexpr std::string_view Method{"method"};
 constexpr std::string_view Mutable{"mut"};
 constexpr std::string_view Namespace{"namespace"};
 constexpr std::string_view New{"new"};
+constexpr std::string_view NoInline{"noinline"};
+constexpr std::string_view Packed{"packed"};
 constexpr std::string_view Return{"return"};
 constexpr std::string_view Structure{"struct"};
+constexpr std::string_view Tail{"tail"};
 constexpr std::string_view True{"true"};
 constexpr std::string_view Type{"type"};
+constexpr std::string_view Uninitialized{"uninit"};
 constexpr std::string_view UnitLiteral{"unit"};
+constexpr std::string_view Unroll{"unroll"};
+constexpr std::string_view Vectorize{"vectorize"};
 constexpr std::string_view While{"while"};
 
 }  // namespace l0::Keyword
@@ -32,6 +47,15 @@ namespace l0::Typename
 {
 
 constexpr std::string_view Integer{"I64"};
+constexpr std::string_view Integer8{"I8"};
+constexpr std::string_view Integer16{"I16"};
+constexpr std::string_view Integer32{"I32"};
+constexpr std::string_view UnsignedInteger8{"U8"};
+constexpr std::string_view UnsignedInteger16{"U16"};
+constexpr std::string_view UnsignedInteger32{"U32"};
+constexpr std::string_view UnsignedInteger64{"U64"};
+constexpr std::string_view Float32{"F32"};
+constexpr std::string_view Float64{"F64"};
 constexpr std::string_view Unit{"()"};
 constexpr std::string_view Boolean{"Boolean"};
 constexpr std::string_view Character{"C8"};
@@ -0,0 +1,244 @@
+#include "l0/generation/closure_specializer.h"
+
+#include <llvm/IR/InstIterator.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+
+#include <algorithm>
+#include <deque>
+#include <format>
+#include <iterator>
+#include <ranges>
+
+namespace l0::detail
+{
+
+ClosureSpecializer::ClosureSpecializer(
+    llvm::Module& module,
+    llvm::StructType* closure_type,
+    const std::unordered_map<llvm::Function*, llvm::Function*>& adapted_functions,
+    std::size_t budget
+)
+    : module_{module},
+      closure_type_{closure_type},
+      adapted_functions_{adapted_functions},
+      budget_{budget}
+{
+}
+
+void ClosureSpecializer::Run()
+{
+    // clones are specialized like any other function, since they may pass the substituted closures on
+    std::deque<llvm::Function*> worklist{};
+    for (auto& function : module_)
+    {
+        if (!function.isDeclarationForLinker())
+        {
+            worklist.push_back(&function);
+        }
+    }
+
+    while (!worklist.empty())
+    {
+        auto function = worklist.front();
+        worklist.pop_front();
+        std::ranges::copy(SpecializeCalls(*function), std::back_inserter(worklist));
+    }
+}
+
+std::vector<llvm::Function*> ClosureSpecializer::SpecializeCalls(llvm::Function& caller)
+{
+    std::vector<llvm::Function*> clones{};
+
+    for (auto& instruction : llvm::instructions(caller))
+    {
+        auto call = llvm::dyn_cast<llvm::CallInst>(&instruction);
+        auto callee = call ? call->getCalledFunction() : nullptr;
+        if (!callee || callee->isDeclarationForLinker() || adapted_functions_.contains(callee)
+            || clones_.contains(callee))
+        {
+            continue;
+        }
+
+        ConstantArguments arguments{};
+        for (auto index : std::views::iota(0u, call->arg_size()))
+        {
+            if (auto closure = GetConstantClosure(call->getArgOperand(index)))
+            {
+                arguments.emplace_back(index, closure);
+            }
+        }
+        if (arguments.empty())
+        {
+            continue;
+        }
+
+        auto specialization = specializations_.find({callee, arguments});
+        if (specialization != specializations_.end())
+        {
+            call->setCalledFunction(specialization->second);
+            continue;
+        }
+
+        auto clone = Specialize(*callee, arguments);
+        if (clone)
+        {
+            call->setCalledFunction(clone);
+            clones.push_back(clone);
+        }
+    }
+
+    return clones;
+}
+
+llvm::Function* ClosureSpecializer::Specialize(llvm::Function& callee, const ConstantArguments& arguments)
+{
+    const std::size_t size = callee.getInstructionCount();
+    if (size > budget_)
+    {
+        return nullptr;
+    }
+    budget_ -= size;
+
+    llvm::ValueToValueMapTy value_map{};
+    auto clone = llvm::CloneFunction(&callee, value_map);
+    clone->setName(std::format("{}.specialized", callee.getName().str()));
+    clone->setLinkage(llvm::GlobalValue::PrivateLinkage);
+
+    for (const auto& [index, closure] : arguments)
+    {
+        clone->getArg(index)->replaceAllUsesWith(closure);
+    }
+    CallDirectly(*clone);
+
+    specializations_.emplace(std::pair{&callee, arguments}, clone);
+    clones_.insert(clone);
+    return clone;
+}
+
+void ClosureSpecializer::CallDirectly(llvm::Function& function)
+{
+    // forward the substituted closures through the stack slots of the parameters (and of the locals they are copied
+    // to) to the calls, until all calls through them have a constant callee
+    bool changed{true};
+    while (changed)
+    {
+        changed = false;
+        for (auto& instruction : llvm::make_early_inc_range(llvm::instructions(function)))
+        {
+            llvm::Constant* replacement = nullptr;
+            if (auto load = llvm::dyn_cast<llvm::LoadInst>(&instruction))
+            {
+                auto pointer = load->getPointerOperand();
+                auto gep = llvm::dyn_cast<llvm::GetElementPtrInst>(pointer);
+                auto alloca = llvm::dyn_cast<llvm::AllocaInst>(gep ? gep->getPointerOperand() : pointer);
+                auto closure = alloca ? GetStoredConstant(*alloca) : nullptr;
+                if (closure && !gep)
+                {
+                    replacement = closure;
+                }
+                else if (closure && gep->getSourceElementType() == closure_type_ && gep->getNumIndices() == 2
+                         && gep->hasAllConstantIndices())
+                {
+                    auto member = llvm::cast<llvm::ConstantInt>(gep->getOperand(2))->getZExtValue();
+                    replacement = closure->getAggregateElement(member);
+                }
+            }
+            else if (auto extract_value = llvm::dyn_cast<llvm::ExtractValueInst>(&instruction))
+            {
+                auto closure = llvm::dyn_cast<llvm::Constant>(extract_value->getAggregateOperand());
+                if (closure && extract_value->getNumIndices() == 1)
+                {
+                    replacement = closure->getAggregateElement(extract_value->getIndices()[0]);
+                }
+            }
+
+            if (replacement)
+            {
+                instruction.replaceAllUsesWith(replacement);
+                instruction.eraseFromParent();
+                changed = true;
+            }
+        }
+    }
+
+    // calls of adapters become calls of the adapted functions; musttail calls keep the adapter, whose prototype matches
+    for (auto& instruction : llvm::make_early_inc_range(llvm::instructions(function)))
+    {
+        auto call = llvm::dyn_cast<llvm::CallInst>(&instruction);
+        auto adapter = call ? call->getCalledFunction() : nullptr;
+        auto adapted_function = adapter ? adapted_functions_.find(adapter) : adapted_functions_.end();
+        if (adapted_function == adapted_functions_.end() || call->isMustTailCall())
+        {
+            continue;
+        }
+
+        // the last argument is the context, which the adapter ignores
+        std::vector<llvm::Value*> arguments{call->arg_begin(), call->arg_end() - 1};
+        auto direct_call = llvm::CallInst::Create(adapted_function->second, arguments, "", call);
+        direct_call->setCallingConv(adapted_function->second->getCallingConv());
+        direct_call->takeName(call);
+        call->replaceAllUsesWith(direct_call);
+        call->eraseFromParent();
+    }
+}
+
+llvm::Constant* ClosureSpecializer::GetConstantClosure(llvm::Value* value) const
+{
+    if (value->getType() != closure_type_)
+    {
+        return nullptr;
+    }
+
+    if (auto closure = llvm::dyn_cast<llvm::Constant>(value))
+    {
+        auto function = closure->getAggregateElement(0u);
+        auto context = closure->getAggregateElement(1u);
+        const bool is_constant = function && llvm::isa<llvm::Function>(function) && context && context->isNullValue();
+        return is_constant ? closure : nullptr;
+    }
+
+    auto load = llvm::dyn_cast<llvm::LoadInst>(value);
+    if (!load)
+    {
+        return nullptr;
+    }
+    if (auto global_variable = llvm::dyn_cast<llvm::GlobalVariable>(load->getPointerOperand()))
+    {
+        return (global_variable->isConstant() && global_variable->hasDefinitiveInitializer())
+                 ? GetConstantClosure(global_variable->getInitializer())
+                 : nullptr;
+    }
+    if (auto alloca = llvm::dyn_cast<llvm::AllocaInst>(load->getPointerOperand()))
+    {
+        return GetStoredConstant(*alloca);
+    }
+    return nullptr;
+}
+
+llvm::Constant* ClosureSpecializer::GetStoredConstant(llvm::AllocaInst& alloca) const
+{
+    // every local is initialized by its declaration before it can be read, so a single store reaches all loads, as long
+    // as the address is only used to access the closure and its members
+    llvm::StoreInst* store = nullptr;
+    for (auto user : alloca.users())
+    {
+        if (llvm::isa<llvm::LoadInst>(user))
+        {
+            continue;
+        }
+        if (auto gep = llvm::dyn_cast<llvm::GetElementPtrInst>(user);
+            gep && std::ranges::all_of(gep->users(), [](auto user) { return llvm::isa<llvm::LoadInst>(user); }))
+        {
+            continue;
+        }
+        auto candidate = llvm::dyn_cast<llvm::StoreInst>(user);
+        if (!candidate || candidate->getValueOperand() == &alloca || store)
+        {
+            return nullptr;
+        }
+        store = candidate;
+    }
+    return store ? GetConstantClosure(store->getValueOperand()) : nullptr;
+}
+
+}  // namespace l0::detail
@@ -0,0 +1,60 @@
+#ifndef L0_GENERATION_CLOSURE_SPECIALIZER_H
+#define L0_GENERATION_CLOSURE_SPECIALIZER_H
+
+#include <llvm/IR/Constant.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/Module.h>
+
+#include <cstddef>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace l0::detail
+{
+
+/// @brief Clones functions of a module for the constant closures they are called with.
+///
+/// A closure argument is constant if it wraps a global function or a lambda without captures, i.e. if its context is
+/// null. For every call passing such closures, the callee is cloned with the closures substituted for the parameters,
+/// so that the calls through them become direct calls of the wrapped functions, which the optimizer can inline. Calls
+/// within the clones are specialized in turn, which covers recursive higher-order functions and closures passed on.
+///
+/// The clones keep the signature of the original function, so that call sites only need to change their callee. The
+/// total number of instructions cloned is limited by the budget; calls for which the budget does not suffice remain
+/// unchanged.
+class ClosureSpecializer
+{
+   public:
+    ClosureSpecializer(
+        llvm::Module& module,
+        llvm::StructType* closure_type,
+        const std::unordered_map<llvm::Function*, llvm::Function*>& adapted_functions,
+        std::size_t budget
+    );
+    void Run();
+
+   private:
+    llvm::Module& module_;
+    llvm::StructType* closure_type_;
+    const std::unordered_map<llvm::Function*, llvm::Function*>& adapted_functions_;
+    std::size_t budget_;
+
+    using ConstantArguments = std::vector<std::pair<unsigned, llvm::Constant*>>;
+    std::map<std::pair<llvm::Function*, ConstantArguments>, llvm::Function*> specializations_;
+    std::unordered_set<llvm::Function*> clones_;
+
+    std::vector<llvm::Function*> SpecializeCalls(llvm::Function& caller);
+    llvm::Function* Specialize(llvm::Function& callee, const ConstantArguments& arguments);
+    void CallDirectly(llvm::Function& function);
+    llvm::Constant* GetConstantClosure(llvm::Value* value) const;
+    llvm::Constant* GetStoredConstant(llvm::AllocaInst& alloca) const;
+};
+
+}  // namespace l0::detail
+
+#endif
@@ -1,13 +1,19 @@
 #include "l0/generation/generation.h"
 
 #include "l0/generation/generator.h"
+#include "l0/generation/inline_importer.h"
 
 namespace l0
 {
 
-void GenerateIR(Module& module, llvm::LLVMContext& context)
+void GenerateIR(Module& module, llvm::LLVMContext& context, GeneratorOptions options)
 {
-    detail::Generator{context, module}.Run();
+    detail::Generator{context, module, options}.Run();
+}
+
+void ImportInlineFunctions(Module& module, const Module& source)
+{
+    detail::InlineImporter{*module.intermediate_representation, *source.intermediate_representation}.Run();
 }
 
 }  // namespace l0
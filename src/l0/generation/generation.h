@@ -3,12 +3,34 @@
 
 #include <llvm/IR/LLVMContext.h>
 
+#include <cstddef>
+
 #include "l0/ast/module.h"
 
 namespace l0
 {
 
-void GenerateIR(Module& module, llvm::LLVMContext& context);
+struct GeneratorOptions
+{
+    // Keep immutable, non-struct locals and parameters in SSA registers instead of stack slots
+    bool keep_constants_in_registers{false};
+
+    // Set the fast-math flags on the floating-point operations of all functions, not only of 'fastmath' ones
+    bool fast_math{false};
+
+    // Trap on out-of-range indices and slice bounds, unless the bounds check elimination has proven them in range
+    bool bounds_checks{false};
+
+    // Maximum number of instructions cloned per module to specialize functions for the constant closures they are
+    // called with, e.g. global functions and lambdas without captures passed to higher-order functions; 0 disables it
+    std::size_t specialization_budget{1000};
+};
+
+void GenerateIR(Module& module, llvm::LLVMContext& context, GeneratorOptions options = {});
+
+// Copy the bodies of the 'inline' functions of `source` that are called by `module` as available_externally
+// definitions; both modules must have been generated already
+void ImportInlineFunctions(Module& module, const Module& source);
 
 }
 
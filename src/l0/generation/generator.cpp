@@ -1,15 +1,23 @@
 #include "l0/generation/generator.h"
 
+#include <llvm/Analysis/ValueTracking.h>
+#include <llvm/IR/InstIterator.h>
 #include <llvm/IR/Verifier.h>
+#include <llvm/MC/TargetRegistry.h>
 #include <llvm/Support/TargetSelect.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Target/TargetOptions.h>
+#include <llvm/TargetParser/Host.h>
 #include <llvm/Transforms/IPO/GlobalDCE.h>
 #include <llvm/Transforms/IPO/StripDeadPrototypes.h>
 
 #include <algorithm>
 #include <format>
+#include <memory>
 #include <ranges>
 #include <string>
 
+#include "l0/generation/closure_specializer.h"
 #include "l0/generation/generator_error.h"
 
 namespace l0::detail
@@ -23,16 +31,18 @@ std::string GetLambdaName()
 
 constexpr std::string kAllocationBlockName{"allocas"};
 constexpr std::string kEntryBlockName{"entry"};
+constexpr std::uint64_t kMaxSwitchCasesPerRange{64};
 
-Generator::Generator(llvm::LLVMContext& context, Module& module)
+Generator::Generator(llvm::LLVMContext& context, Module& module, GeneratorOptions options)
     : ast_module_{module},
+      options_{options},
       context_{context},
       builder_{context_},
       llvm_module_{new llvm::Module{module.name, context_}},
-      type_converter_{context_}
+      type_converter_{context_, data_layout_}
 {
     pointer_type_ = llvm::PointerType::get(context_, 0);
-    closure_type_ = llvm::StructType::getTypeByName(context_, "__closure");
+    closure_type_ = type_converter_.GetClosureType();
     int_type_ = llvm::IntegerType::getInt64Ty(context_);
     char_type_ = llvm::IntegerType::getInt8Ty(context_);
     bool_type_ = llvm::IntegerType::getInt1Ty(context_);
@@ -43,17 +53,31 @@ void Generator::Run()
     llvm::InitializeNativeTarget();
     llvm::InitializeNativeTargetAsmPrinter();
     llvm::InitializeNativeTargetAsmParser();
-    llvm_module_->setTargetTriple("x86_64-pc-linux-gnu");
+    SetTarget();
 
     DeclareTypes();
+    DefineTypes();
+
     DeclareEnvironmentVariables();
     DeclareExternalVariables();
     DeclareGlobalVariables();
     DeclareCallables();
 
-    DefineTypes();
+    DefineDefaultInitializers();
     DefineGlobalVariables();
     DefineCallables();
+    SetGenericInstanceLinkage();
+
+    if (options_.specialization_budget > 0)
+    {
+        ClosureSpecializer{*llvm_module_, closure_type_, adapted_functions_, options_.specialization_budget}.Run();
+    }
+
+    // L0 has no exceptions, so neither L0 functions nor the C functions they call can unwind
+    for (auto& llvm_function : *llvm_module_)
+    {
+        llvm_function.addFnAttr(llvm::Attribute::NoUnwind);
+    }
 
     llvm::ModuleAnalysisManager mam;
     llvm::GlobalDCEPass global_dce_pass{};
@@ -62,14 +86,35 @@ void Generator::Run()
     ast_module_.intermediate_representation = llvm_module_;
 }
 
+void Generator::SetTarget()
+{
+    // The data layout decides which aggregates are passed by pointer, so it is taken from the target machine before any
+    // type is converted; otherwise LLVM's default alignments would be used. Only the native target is initialized, so
+    // the host is targeted.
+    const std::string target_triple = llvm::sys::getDefaultTargetTriple();
+    std::string error{};
+    auto target = llvm::TargetRegistry::lookupTarget(target_triple, error);
+    if (!target)
+    {
+        throw GeneratorError(std::format("Cannot find target '{}': {}", target_triple, error));
+    }
+
+    std::unique_ptr<llvm::TargetMachine> target_machine{
+        target->createTargetMachine(target_triple, "generic", "", llvm::TargetOptions{}, llvm::Reloc::PIC_)
+    };
+    llvm_module_->setTargetTriple(target_triple);
+    llvm_module_->setDataLayout(target_machine->createDataLayout());
+    data_layout_ = llvm_module_->getDataLayout();
+}
+
 void Generator::DeclareTypes()
 {
     for (const auto& type_name : ast_module_.externals->GetTypes())
     {
         auto type = ast_module_.externals->GetTypeDefinition(type_name);
-        if (dynamic_pointer_cast<StructType>(type))
+        if (dynamic_pointer_cast<StructType>(type) && !ast_module_.globals->IsTypeDeclared(type_name))
         {
-            llvm::StructType::create(context_, type_name.ToString());
+            type_converter_.DeclareStructType(type_name);
         }
     }
     for (const auto& type_name : ast_module_.globals->GetTypes())
@@ -77,7 +122,7 @@ void Generator::DeclareTypes()
         auto type = ast_module_.globals->GetTypeDefinition(type_name);
         if (dynamic_pointer_cast<StructType>(type))
         {
-            llvm::StructType::create(context_, type_name.ToString());
+            type_converter_.DeclareStructType(type_name);
         }
     }
 }
@@ -88,13 +133,14 @@ void Generator::DeclareEnvironmentVariables()
     {
         auto type = ast_module_.environment->GetVariableType(environment_symbol);
         auto function_type = dynamic_pointer_cast<FunctionType>(type);
-        auto llvm_type = type_converter_.Convert(*function_type);
+        auto llvm_type = type_converter_.GetDirectFunctionDeclarationType(*function_type);
 
         llvm::FunctionCallee function_callee =
             llvm_module_->getOrInsertFunction(environment_symbol.ToString(), llvm_type);
+        auto llvm_function = llvm::dyn_cast<llvm::Function>(function_callee.getCallee());
 
         std::vector<llvm::Constant*> closure_members{};
-        closure_members.push_back(llvm::dyn_cast<llvm::Function>(function_callee.getCallee()));
+        closure_members.push_back(GenerateClosureAdapter(*llvm_function));
         closure_members.push_back(llvm::ConstantPointerNull::get(pointer_type_));
         auto closure = llvm::ConstantStruct::get(closure_type_, closure_members);
 
@@ -114,12 +160,39 @@ void Generator::DeclareExternalVariables()
 {
     for (const Identifier& external_symbol : ast_module_.externals->GetVariables())
     {
+        // instances of generics used by several modules are declared by each of them
+        if (ast_module_.globals->IsVariableDeclared(external_symbol))
+        {
+            continue;
+        }
+        if (DeclareEnumMember(*ast_module_.externals, external_symbol))
+        {
+            continue;
+        }
         auto type = ast_module_.externals->GetVariableType(external_symbol);
         auto llvm_type = type_converter_.GetValueDeclarationType(*type);
         auto global_var = new llvm::GlobalVariable(
             *llvm_module_, llvm_type, true, llvm::GlobalValue::ExternalLinkage, nullptr, external_symbol.ToString()
         );
         ast_module_.externals->SetLLVMValue(external_symbol, global_var);
+
+        auto inline_external = ast_module_.inline_externals.find(external_symbol);
+        if (inline_external == ast_module_.inline_externals.end())
+        {
+            continue;
+        }
+        const auto& function = *inline_external->second;
+        auto function_type = dynamic_pointer_cast<FunctionType>(function.type);
+        auto llvm_function = llvm::Function::Create(
+            type_converter_.GetDirectFunctionDeclarationType(*function_type),
+            llvm::GlobalValue::LinkageTypes::ExternalLinkage,
+            function.global_name.value(),
+            llvm_module_
+        );
+        llvm_function->setCallingConv(llvm::CallingConv::Fast);
+        AddFunctionAttributes(*llvm_function, function);
+        AddParameterAttributes(*llvm_function, *function_type);
+        imported_functions_.emplace(global_var, llvm_function);
     }
 }
 
@@ -127,7 +200,7 @@ void Generator::DeclareGlobalVariables()
 {
     for (const auto& global_symbol : ast_module_.globals->GetVariables())
     {
-        if (global_symbol.ToString() == "main")
+        if (global_symbol.ToString() == "main" || DeclareEnumMember(*ast_module_.globals, global_symbol))
         {
             continue;
         }
@@ -140,6 +213,20 @@ void Generator::DeclareGlobalVariables()
     }
 }
 
+bool Generator::DeclareEnumMember(Scope& scope, const Identifier& symbol)
+{
+    // Enum members are not stored in memory, but used as immediate constants within each module
+    auto enum_type = dynamic_pointer_cast<EnumType>(scope.GetVariableType(symbol));
+    auto index = enum_type ? enum_type->GetMemberIndex(symbol) : std::nullopt;
+    if (!index)
+    {
+        return false;
+    }
+    auto llvm_type = type_converter_.GetValueDeclarationType(*enum_type);
+    scope.SetLLVMValue(symbol, llvm::ConstantInt::get(llvm_type, *index), false);
+    return true;
+}
+
 void Generator::DeclareCallables()
 {
     for (auto callable : ast_module_.callables)
@@ -158,30 +245,136 @@ void Generator::DeclareCallable(std::shared_ptr<Function> function)
         ));
     }
 
-    const auto llvm_type = type_converter_.GetFunctionDeclarationType(*type);
-    const auto linkage = (function->global_name == "main") ? llvm::GlobalValue::LinkageTypes::ExternalLinkage
-                                                           : llvm::GlobalValue::LinkageTypes::PrivateLinkage;
-    llvm::Function::Create(llvm_type, linkage, function->global_name.value(), llvm_module_);
+    // inline functions are visible to other modules, which import their bodies
+    const bool is_main = (function->global_name == "main");
+    const auto llvm_type = type_converter_.GetDirectFunctionDeclarationType(*type);
+    const auto linkage = (is_main || function->inlining == Function::Inlining::Always)
+                           ? llvm::GlobalValue::LinkageTypes::ExternalLinkage
+                           : llvm::GlobalValue::LinkageTypes::PrivateLinkage;
+    auto llvm_function = llvm::Function::Create(llvm_type, linkage, function->global_name.value(), llvm_module_);
+
+    if (!is_main)
+    {
+        llvm_function->setCallingConv(llvm::CallingConv::Fast);
+    }
+    AddFunctionAttributes(*llvm_function, *function);
+}
+
+void Generator::AddFunctionAttributes(llvm::Function& llvm_function, const Function& function)
+{
+    switch (function.inlining)
+    {
+        case Function::Inlining::Always:
+        {
+            llvm_function.addFnAttr(llvm::Attribute::AlwaysInline);
+            break;
+        }
+        case Function::Inlining::Never:
+        {
+            llvm_function.addFnAttr(llvm::Attribute::NoInline);
+            break;
+        }
+        case Function::Inlining::Default:
+        {
+            break;
+        }
+    }
+
+    switch (function.temperature)
+    {
+        case Function::Temperature::Hot:
+        {
+            llvm_function.addFnAttr(llvm::Attribute::Hot);
+            break;
+        }
+        case Function::Temperature::Cold:
+        {
+            llvm_function.addFnAttr(llvm::Attribute::Cold);
+            break;
+        }
+        case Function::Temperature::Default:
+        {
+            break;
+        }
+    }
+}
+
+void Generator::AddParameterAttributes(llvm::Function& llvm_function, const FunctionType& type)
+{
+    // large results are returned through the first parameter
+    const std::size_t first_parameter = type_converter_.IsLargeAggregate(*type.return_type) ? 1 : 0;
+    if (first_parameter > 0)
+    {
+        auto return_type = type_converter_.GetValueDeclarationType(*type.return_type);
+        llvm_function.addParamAttr(0, llvm::Attribute::getWithStructRetType(context_, return_type));
+        llvm_function.addParamAttr(0, llvm::Attribute::NoAlias);
+    }
+
+    for (auto parameter_index : std::views::iota(std::size_t{0}, type.parameters->size()))
+    {
+        const auto index = first_parameter + parameter_index;
+        const auto& parameter_type = *type.parameters->at(parameter_index);
+
+        // large arguments point to copies owned by the call
+        if (type_converter_.IsLargeAggregate(parameter_type))
+        {
+            llvm_function.addParamAttr(index, llvm::Attribute::NoAlias);
+            llvm_function.addParamAttr(index, llvm::Attribute::NonNull);
+            if (parameter_type.mutability == TypeQualifier::Constant)
+            {
+                llvm_function.addParamAttr(index, llvm::Attribute::ReadOnly);
+            }
+            llvm_function.addDereferenceableParamAttr(
+                index, data_layout_.getTypeAllocSize(type_converter_.GetValueDeclarationType(parameter_type))
+            );
+            continue;
+        }
+
+        auto reference_type = dynamic_cast<const ReferenceType*>(&parameter_type);
+        if (!reference_type)
+        {
+            continue;
+        }
+
+        llvm_function.addParamAttr(index, llvm::Attribute::NonNull);
+        llvm_function.addParamAttr(index, llvm::Attribute::NoUndef);
+        if (reference_type->base_type->mutability == TypeQualifier::Constant)
+        {
+            llvm_function.addParamAttr(index, llvm::Attribute::ReadOnly);
+        }
+
+        llvm::Type* base_type = type_converter_.Convert(*reference_type->base_type);
+        if (base_type->isSized() && data_layout_.getTypeAllocSize(base_type) > 0)
+        {
+            llvm_function.addDereferenceableParamAttr(index, data_layout_.getTypeAllocSize(base_type));
+        }
+    }
 }
 
 void Generator::DefineTypes()
 {
-    for (const auto& type_declaration : ast_module_.global_type_declarations)
+    // the layouts of all structs, including those of other modules, decide which of them are passed by reference, so
+    // they are defined before any function is declared
+    for (const auto& type_name : ast_module_.externals->GetTypes())
     {
-        if (auto struct_type = dynamic_pointer_cast<StructType>(type_declaration->type))
+        auto struct_type = dynamic_pointer_cast<StructType>(ast_module_.externals->GetTypeDefinition(type_name));
+        if (struct_type && !ast_module_.globals->IsTypeDeclared(type_name))
         {
             DefineStructType(*struct_type);
         }
-        else if (auto enum_type = dynamic_pointer_cast<EnumType>(type_declaration->type))
+    }
+    for (const auto& type_declaration : ast_module_.global_type_declarations)
+    {
+        if (auto struct_type = dynamic_pointer_cast<StructType>(type_declaration->type))
         {
-            DefineEnumType(*enum_type);
+            DefineStructType(*struct_type);
         }
     }
 }
 
 void Generator::DefineStructType(const StructType& type)
 {
-    auto llvm_struct_type = llvm::StructType::getTypeByName(context_, type.identifier.ToString());
+    auto llvm_struct_type = llvm::cast<llvm::StructType>(type_converter_.Convert(type));
 
     // clang-format off
     auto non_static_members = *type.members
@@ -190,8 +383,22 @@ void Generator::DefineStructType(const StructType& type)
         | std::ranges::to<std::vector>();
     // clang-format on
 
-    llvm_struct_type->setBody(non_static_members, true);
+    llvm_struct_type->setBody(non_static_members, type.is_packed);
+}
+
+void Generator::DefineDefaultInitializers()
+{
+    for (const auto& type_declaration : ast_module_.global_type_declarations)
+    {
+        if (auto struct_type = dynamic_pointer_cast<StructType>(type_declaration->type))
+        {
+            DefineDefaultInitializers(*struct_type);
+        }
+    }
+}
 
+void Generator::DefineDefaultInitializers(const StructType& type)
+{
     for (auto member : *type.members)
     {
         if (!member->default_initializer)
@@ -206,17 +413,6 @@ void Generator::DefineStructType(const StructType& type)
     }
 }
 
-void Generator::DefineEnumType(const EnumType& type)
-{
-    for (const auto& [index, member] : *type.members | std::views::enumerate)
-    {
-        Identifier full_member_name = type.identifier + *member;
-        const auto llvm_value = ast_module_.globals->GetLLVMValue(full_member_name);
-        const auto global_var = llvm::dyn_cast<llvm::GlobalVariable>(llvm_value);
-        global_var->setInitializer(llvm::ConstantInt::get(int_type_, index));
-    }
-}
-
 void Generator::DefineGlobalVariables()
 {
     for (const auto& global_declaration : ast_module_.global_declarations)
@@ -247,8 +443,58 @@ void Generator::DefineCallables()
                 std::format("Callable with name '{}' has not been declared.", callable->global_name.value())
             );
         }
+        AddParameterAttributes(*llvm_function, dynamic_cast<const FunctionType&>(*callable->type));
         GenerateFunctionBody(*callable, *llvm_function);
     }
+
+    // adapters may have been generated before the attributes of the adapted functions were known
+    for (auto [adapter, function] : adapted_functions_)
+    {
+        for (auto index : std::views::iota(0u, function->arg_size()))
+        {
+            adapter->addParamAttrs(index, llvm::AttrBuilder{context_, function->getAttributes().getParamAttrs(index)});
+        }
+    }
+}
+
+void Generator::SetGenericInstanceLinkage()
+{
+    // every module defines the instances of generics it uses, and the linker keeps one of each
+    auto set_linkage = [this](const Identifier& global_name, std::shared_ptr<Expression> initializer)
+    {
+        auto global_var = llvm::dyn_cast<llvm::GlobalVariable>(ast_module_.globals->GetLLVMValue(global_name));
+        global_var->setLinkage(llvm::GlobalValue::WeakODRLinkage);
+
+        auto function = dynamic_pointer_cast<Function>(initializer);
+        auto llvm_function = function ? llvm_module_->getFunction(function->global_name.value()) : nullptr;
+        if (llvm_function && !llvm_function->hasLocalLinkage())
+        {
+            llvm_function->setLinkage(llvm::GlobalValue::WeakODRLinkage);
+        }
+    };
+
+    for (const auto& declaration : ast_module_.global_declarations)
+    {
+        if (ast_module_.generic_instances.contains(declaration->identifier))
+        {
+            set_linkage(declaration->identifier, declaration->initializer);
+        }
+    }
+    for (const auto& type_declaration : ast_module_.global_type_declarations)
+    {
+        auto struct_type = dynamic_pointer_cast<StructType>(type_declaration->type);
+        if (!struct_type || !ast_module_.generic_instances.contains(type_declaration->identifier))
+        {
+            continue;
+        }
+        for (const auto& member : *struct_type->members)
+        {
+            if (member->default_initializer_global_name)
+            {
+                set_linkage(*member->default_initializer_global_name, member->default_initializer);
+            }
+        }
+    }
 }
 
 void Generator::Visit(const StatementBlock& statement_block)
@@ -261,15 +507,26 @@ void Generator::Visit(const StatementBlock& statement_block)
 
 void Generator::Visit(const Declaration& declaration)
 {
-    declaration.initializer->Accept(*this);
-    llvm::Value* initializer = result_store_.GetResult();
-
     std::shared_ptr<Type> type = declaration.scope->GetVariableType(declaration.identifier);
+    if (KeepInRegister(*type))
+    {
+        declaration.initializer->Accept(*this);
+        declaration.scope->SetLLVMValue(declaration.identifier, result_store_.GetResult(), false);
+        result_store_.Clear();
+        return;
+    }
+
     llvm::Type* llvm_type = type_converter_.GetValueDeclarationType(*type);
     llvm::AllocaInst* alloca = GenerateAlloca(builder_, llvm_type, declaration.identifier.ToString());
 
+    if (IsConstructedInPlace(*declaration.initializer))
+    {
+        in_place_result_address_ = alloca;
+    }
+    declaration.initializer->Accept(*this);
+
     declaration.scope->SetLLVMValue(declaration.identifier, alloca);
-    builder_.CreateStore(initializer, alloca);
+    StoreResult(alloca, *type);
 
     result_store_.Clear();
 }
@@ -284,9 +541,53 @@ void Generator::Visit(const ExpressionStatement& expression_statement)
 
 void Generator::Visit(const ReturnStatement& return_statement)
 {
+    // large aggregates are returned through the memory of the caller
+    llvm::Function* llvm_function = builder_.GetInsertBlock()->getParent();
+    llvm::Value* result_address = llvm_function->hasStructRetAttr() ? llvm_function->getArg(0) : nullptr;
+    if (result_address && IsConstructedInPlace(*return_statement.value))
+    {
+        in_place_result_address_ = result_address;
+    }
+
     return_statement.value->Accept(*this);
-    auto return_value = result_store_.GetResult();
-    builder_.CreateRet(return_value);
+
+    llvm::Value* return_value = nullptr;
+    llvm::CallInst* call = nullptr;
+    if (result_address)
+    {
+        StoreResult(result_address, *return_statement.value->type);
+        call = dynamic_pointer_cast<Call>(return_statement.value)
+                 ? llvm::dyn_cast<llvm::CallInst>(&builder_.GetInsertBlock()->back())
+                 : nullptr;
+    }
+    else
+    {
+        return_value = result_store_.GetResult();
+        call = llvm::dyn_cast<llvm::CallInst>(return_value);
+    }
+
+    bool is_tail_call = call && IsTailCallCompatible(*call);
+    if (return_statement.is_tail_call && !is_tail_call)
+    {
+        throw GeneratorError(std::format(
+            "Cannot guarantee tail call in function '{}', since caller and callee differ in signature or calling "
+            "convention.",
+            llvm_function->getName().str()
+        ));
+    }
+    if (is_tail_call)
+    {
+        tail_calls_.push_back({.call = call, .is_explicit = return_statement.is_tail_call});
+    }
+
+    if (result_address)
+    {
+        builder_.CreateRetVoid();
+    }
+    else
+    {
+        builder_.CreateRet(return_value);
+    }
     result_store_.Clear();
 }
 
@@ -337,6 +638,100 @@ void Generator::Visit(const ConditionalStatement& conditional_statement)
     result_store_.Clear();
 }
 
+void Generator::Visit(const MatchStatement& match_statement)
+{
+    match_statement.subject->Accept(*this);
+    auto subject = result_store_.GetResult();
+    auto subject_type = llvm::cast<llvm::IntegerType>(subject->getType());
+
+    bool merge_needed = (match_statement.else_block && !match_statement.else_block_returns)
+                     || std::ranges::any_of(
+                            *match_statement.cases, [](const auto& match_case) { return !match_case->body_returns; }
+                     );
+
+    llvm::Function* llvm_function = builder_.GetInsertBlock()->getParent();
+    llvm::BasicBlock* default_block = llvm::BasicBlock::Create(context_, "matchdefault");
+    llvm::BasicBlock* merge_block = merge_needed ? llvm::BasicBlock::Create(context_, "matchcont") : nullptr;
+
+    auto switch_instruction = builder_.CreateSwitch(subject, default_block, match_statement.cases->size());
+
+    // small ranges become individual cases of the switch, large ones are checked before the else block
+    std::vector<std::tuple<const MatchPattern*, llvm::BasicBlock*>> range_checks{};
+    std::vector<llvm::BasicBlock*> case_blocks{};
+    for (const auto& match_case : *match_statement.cases)
+    {
+        auto case_block = llvm::BasicBlock::Create(context_, "case");
+        case_blocks.push_back(case_block);
+
+        for (const auto& pattern : *match_case->patterns)
+        {
+            if (static_cast<std::uint64_t>(pattern->upper) - static_cast<std::uint64_t>(pattern->lower)
+                >= kMaxSwitchCasesPerRange)
+            {
+                range_checks.emplace_back(pattern.get(), case_block);
+                continue;
+            }
+            for (auto value = pattern->lower;; ++value)
+            {
+                switch_instruction->addCase(llvm::ConstantInt::get(subject_type, value, true), case_block);
+                if (value == pattern->upper)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    for (auto index : std::views::iota(std::size_t{0}, case_blocks.size()))
+    {
+        const auto& match_case = *match_statement.cases->at(index);
+        auto case_block = case_blocks.at(index);
+        llvm_function->insert(llvm_function->end(), case_block);
+        builder_.SetInsertPoint(case_block);
+        match_case.body->Accept(*this);
+        if (!match_case.body_returns)
+        {
+            builder_.CreateBr(merge_block);
+        }
+    }
+
+    llvm_function->insert(llvm_function->end(), default_block);
+    builder_.SetInsertPoint(default_block);
+    for (auto [pattern, case_block] : range_checks)
+    {
+        auto offset =
+            builder_.CreateSub(subject, llvm::ConstantInt::get(subject_type, pattern->lower, true), "rangeoffset");
+        auto in_range = builder_.CreateICmpULE(
+            offset, llvm::ConstantInt::get(subject_type, pattern->upper - pattern->lower, true), "inrange"
+        );
+        auto next_block = llvm::BasicBlock::Create(context_, "matchdefault", llvm_function);
+        builder_.CreateCondBr(in_range, case_block, next_block);
+        builder_.SetInsertPoint(next_block);
+    }
+
+    if (!match_statement.else_block)
+    {
+        // the typechecker has ensured that the cases are exhaustive
+        builder_.CreateUnreachable();
+    }
+    else
+    {
+        match_statement.else_block->Accept(*this);
+        if (!match_statement.else_block_returns)
+        {
+            builder_.CreateBr(merge_block);
+        }
+    }
+
+    if (merge_needed)
+    {
+        llvm_function->insert(llvm_function->end(), merge_block);
+        builder_.SetInsertPoint(merge_block);
+    }
+
+    result_store_.Clear();
+}
+
 void Generator::Visit(const WhileLoop& while_loop)
 {
     llvm::Function* llvm_function = builder_.GetInsertBlock()->getParent();
@@ -364,6 +759,84 @@ void Generator::Visit(const WhileLoop& while_loop)
     result_store_.Clear();
 }
 
+void Generator::Visit(const ForLoop& for_loop)
+{
+    for_loop.begin->Accept(*this);
+    llvm::Value* begin = result_store_.GetResult();
+    for_loop.end->Accept(*this);
+    llvm::Value* end = result_store_.GetResult();
+
+    auto variable_type = for_loop.scope->GetVariableType(for_loop.variable);
+    bool is_signed = dynamic_cast<const IntegerType&>(*variable_type).is_signed;
+
+    llvm::Function* llvm_function = builder_.GetInsertBlock()->getParent();
+    llvm::BasicBlock* preheader = builder_.GetInsertBlock();
+    llvm::BasicBlock* header = llvm::BasicBlock::Create(context_, "forheader", llvm_function);
+    llvm::BasicBlock* body = llvm::BasicBlock::Create(context_, "forbody");
+    llvm::BasicBlock* afterloop = llvm::BasicBlock::Create(context_, "afterfor");
+
+    // the loop variable is an induction variable in SSA form rather than a stack slot, and its increment cannot
+    // overflow since it stays below the end
+    builder_.CreateBr(header);
+    builder_.SetInsertPoint(header);
+    llvm::PHINode* variable = builder_.CreatePHI(begin->getType(), 2, for_loop.variable);
+    variable->addIncoming(begin, preheader);
+    auto condition = is_signed ? builder_.CreateICmpSLT(variable, end) : builder_.CreateICmpULT(variable, end);
+    builder_.CreateCondBr(condition, body, afterloop);
+
+    // body
+    llvm_function->insert(llvm_function->end(), body);
+    builder_.SetInsertPoint(body);
+    for_loop.scope->SetLLVMValue(for_loop.variable, variable, false);
+    for_loop.body->Accept(*this);
+
+    // latch
+    if (!builder_.GetInsertBlock()->getTerminator())
+    {
+        auto one = llvm::ConstantInt::get(begin->getType(), 1);
+        auto next = builder_.CreateAdd(variable, one, "", !is_signed, is_signed);
+        variable->addIncoming(next, builder_.GetInsertBlock());
+        auto backedge = builder_.CreateBr(header);
+        if (auto loop_id = GenerateLoopMetadata(for_loop))
+        {
+            backedge->setMetadata(llvm::LLVMContext::MD_loop, loop_id);
+        }
+    }
+
+    // afterloop
+    llvm_function->insert(llvm_function->end(), afterloop);
+    builder_.SetInsertPoint(afterloop);
+
+    result_store_.Clear();
+}
+
+llvm::MDNode* Generator::GenerateLoopMetadata(const ForLoop& for_loop)
+{
+    std::vector<llvm::Metadata*> properties{};
+    if (for_loop.unroll)
+    {
+        properties.push_back(llvm::MDNode::get(context_, llvm::MDString::get(context_, "llvm.loop.unroll.enable")));
+    }
+    if (for_loop.vectorize)
+    {
+        properties.push_back(llvm::MDNode::get(
+            context_,
+            {llvm::MDString::get(context_, "llvm.loop.vectorize.enable"),
+             llvm::ConstantAsMetadata::get(builder_.getTrue())}
+        ));
+    }
+    if (properties.empty())
+    {
+        return nullptr;
+    }
+
+    // loop IDs are distinct nodes whose first operand refers to themselves
+    properties.insert(properties.begin(), nullptr);
+    auto loop_id = llvm::MDNode::getDistinct(context_, properties);
+    loop_id->replaceOperandWith(0, loop_id);
+    return loop_id;
+}
+
 void Generator::Visit(const Deallocation& deallocation)
 {
     llvm::Type* llvm_ptr_type = llvm::PointerType::get(context_, 0);
@@ -407,6 +880,13 @@ void Generator::Visit(const Assignment& assignment)
     auto target_address = result_store_.GetResultAddress();
 
     assignment.expression->Accept(*this);
+    const Type& type = *assignment.expression->type;
+    if (type_converter_.IsLargeAggregate(type))
+    {
+        StoreResult(target_address, type);
+        result_store_.SetResultAddress(target_address, type_converter_.GetValueDeclarationType(type));
+        return;
+    }
     auto value = result_store_.GetResult();
 
     builder_.CreateStore(value, target_address);
@@ -419,6 +899,7 @@ void Generator::Visit(const UnaryOp& unary_op)
     {
         using Overload = UnaryOp::Overload;
         case Overload::IntegerIdentity:
+        case Overload::FloatIdentity:
         {
             unary_op.operand->Accept(*this);
             // leave result_ and result_address
@@ -432,6 +913,22 @@ void Generator::Visit(const UnaryOp& unary_op)
             result_store_.SetResult(result);
             break;
         }
+        case Overload::IntegerComplement:
+        {
+            unary_op.operand->Accept(*this);
+            llvm::Value* operand = result_store_.GetResult();
+            auto result = builder_.CreateNot(operand, "compltmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::FloatNegation:
+        {
+            unary_op.operand->Accept(*this);
+            llvm::Value* operand = result_store_.GetResult();
+            auto result = builder_.CreateFNeg(operand, "fnegtmp");
+            result_store_.SetResult(result);
+            break;
+        }
         case Overload::BooleanNegation:
         {
             unary_op.operand->Accept(*this);
@@ -502,6 +999,54 @@ void Generator::Visit(const BinaryOp& binary_op)
             break;
         }
         case Overload::IntegerRemainder:
+        {
+            auto result = builder_.CreateSRem(left, right, "sremtmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::IntegerBitwiseAnd:
+        {
+            auto result = builder_.CreateAnd(left, right, "andtmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::IntegerBitwiseOr:
+        {
+            auto result = builder_.CreateOr(left, right, "ortmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::IntegerBitwiseXor:
+        {
+            auto result = builder_.CreateXor(left, right, "xortmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::IntegerShiftLeft:
+        {
+            auto result = builder_.CreateShl(left, MaskShiftAmount(right), "shltmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::IntegerShiftRight:
+        {
+            auto result = builder_.CreateAShr(left, MaskShiftAmount(right), "ashrtmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::UnsignedIntegerShiftRight:
+        {
+            auto result = builder_.CreateLShr(left, MaskShiftAmount(right), "lshrtmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::UnsignedIntegerDivision:
+        {
+            auto result = builder_.CreateUDiv(left, right, "udivtmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::UnsignedIntegerRemainder:
         {
             auto result = builder_.CreateURem(left, right, "uremtmp");
             result_store_.SetResult(result);
@@ -561,9 +1106,100 @@ void Generator::Visit(const BinaryOp& binary_op)
             result_store_.SetResult(result);
             break;
         }
+        case Overload::UnsignedIntegerLess:
+        {
+            auto result = builder_.CreateICmpULT(left, right, "ulttmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::UnsignedIntegerGreater:
+        {
+            auto result = builder_.CreateICmpUGT(left, right, "ugttmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::UnsignedIntegerLessOrEquals:
+        {
+            auto result = builder_.CreateICmpULE(left, right, "uletmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::UnsignedIntegerGreaterOrEquals:
+        {
+            auto result = builder_.CreateICmpUGE(left, right, "ugetmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::FloatAddition:
+        {
+            auto result = builder_.CreateFAdd(left, right, "faddtmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::FloatSubtraction:
+        {
+            auto result = builder_.CreateFSub(left, right, "fsubtmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::FloatMultiplication:
+        {
+            auto result = builder_.CreateFMul(left, right, "fmultmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::FloatDivision:
+        {
+            auto result = builder_.CreateFDiv(left, right, "fdivtmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::FloatRemainder:
+        {
+            auto result = builder_.CreateFRem(left, right, "fremtmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::FloatEquality:
+        {
+            auto result = builder_.CreateFCmpOEQ(left, right, "foeqtmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::FloatInequality:
+        {
+            auto result = builder_.CreateFCmpUNE(left, right, "funetmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::FloatLess:
+        {
+            auto result = builder_.CreateFCmpOLT(left, right, "folttmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::FloatGreater:
+        {
+            auto result = builder_.CreateFCmpOGT(left, right, "fogttmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::FloatLessOrEquals:
+        {
+            auto result = builder_.CreateFCmpOLE(left, right, "foletmp");
+            result_store_.SetResult(result);
+            break;
+        }
+        case Overload::FloatGreaterOrEquals:
+        {
+            auto result = builder_.CreateFCmpOGE(left, right, "fogetmp");
+            result_store_.SetResult(result);
+            break;
+        }
         case Overload::CharacterAddition:
         {
-            auto right_as_i8 = builder_.CreateIntCast(right, char_type_, true, "castmp");
+            auto right_type = dynamic_pointer_cast<IntegerType>(binary_op.right->type);
+            auto right_as_i8 = builder_.CreateIntCast(right, char_type_, right_type->is_signed, "castmp");
             auto result = builder_.CreateAdd(left, right_as_i8, "addtmp");
             result_store_.SetResult(result);
             break;
@@ -582,7 +1218,11 @@ void Generator::Visit(const BinaryOp& binary_op)
 void Generator::Visit(const Variable& variable)
 {
     llvm::Value* llvm_value = variable.scope->GetLLVMValue(variable.resolved_name);
-    if (auto allocation = llvm::dyn_cast<llvm::AllocaInst>(llvm_value))
+    if (!variable.scope->IsLLVMValueAddress(variable.resolved_name))
+    {
+        result_store_.SetResult(llvm_value);
+    }
+    else if (auto allocation = llvm::dyn_cast<llvm::AllocaInst>(llvm_value))
     {
         auto allocated_type = allocation->getAllocatedType();
         result_store_.SetResultAddress(llvm_value, allocated_type);
@@ -595,10 +1235,6 @@ void Generator::Visit(const Variable& variable)
     {
         result_store_.SetResult(llvm_value);
     }
-    else if (llvm::isa<llvm::Argument>(llvm_value))
-    {
-        result_store_.SetResult(llvm_value);
-    }
     else
     {
         auto llvm_type = type_converter_.GetValueDeclarationType(*variable.type);
@@ -608,6 +1244,12 @@ void Generator::Visit(const Variable& variable)
 
 void Generator::Visit(const MemberAccessor& member_accessor)
 {
+    if (member_accessor.builtin_member)
+    {
+        GenerateBuiltinMember(member_accessor);
+        return;
+    }
+
     auto struct_name = member_accessor.dereferenced_object_type->identifier.ToString();
 
     member_accessor.dereferenced_object->Accept(*this);
@@ -626,59 +1268,240 @@ void Generator::Visit(const MemberAccessor& member_accessor)
             std::format("geptmp_{}.{}::{}", object_ptr->getName().str(), struct_name, member_accessor.member)
         );
 
-        result_store_.SetResultAddress(member_address, llvm_member_type);
+        result_store_.SetResultAddress(member_address, llvm_member_type);
+    }
+    else
+    {
+        auto member = member_accessor.dereferenced_object_type->GetMember(member_accessor.member);
+        auto static_initializer =
+            member_accessor.dereferenced_object_type_scope->GetLLVMValue(*member->default_initializer_global_name);
+        auto static_initializer_as_global = llvm::dyn_cast<llvm::GlobalVariable>(static_initializer);
+        if (!static_initializer_as_global)
+        {
+            throw GeneratorError(std::format("Static initializer for {} is not a global variable.", member->name));
+        }
+        VisitGlobal(static_initializer_as_global);
+    }
+
+    result_store_.SetObjectPointerNoOverride(object_ptr);
+}
+
+void Generator::GenerateBuiltinMember(const MemberAccessor& member_accessor)
+{
+    using BuiltinMember = MemberAccessor::BuiltinMember;
+    const auto& object_type = *member_accessor.dereferenced_object->type;
+
+    if (member_accessor.builtin_member == BuiltinMember::Length)
+    {
+        // lengths of arrays and vectors are constant, but the object may still have side effects, e.g. calls
+        member_accessor.dereferenced_object->Accept(*this);
+        if (auto length = GetFixedLength(object_type))
+        {
+            result_store_.SetResult(builder_.getInt64(*length));
+            return;
+        }
+
+        auto slice = result_store_.GetResult();
+        result_store_.SetResult(builder_.CreateExtractValue(slice, 1, "lentmp"));
+        return;
+    }
+
+    member_accessor.dereferenced_object->Accept(*this);
+    auto vector = result_store_.GetResult();
+
+    // floating-point sums and products are only reordered under fast-math; otherwise the lanes are added in order
+    auto element_type = dynamic_cast<const VectorType&>(object_type).element_type;
+    bool is_float = dynamic_pointer_cast<FloatType>(element_type) != nullptr;
+    auto integer_type = dynamic_pointer_cast<IntegerType>(element_type);
+    bool is_signed = integer_type && integer_type->is_signed;
+    auto llvm_element_type = vector->getType()->getScalarType();
+
+    llvm::Value* result{nullptr};
+    switch (*member_accessor.builtin_member)
+    {
+        case BuiltinMember::Sum:
+        {
+            result = is_float ? builder_.CreateFAddReduce(llvm::ConstantFP::getNegativeZero(llvm_element_type), vector)
+                              : builder_.CreateAddReduce(vector);
+            break;
+        }
+        case BuiltinMember::Product:
+        {
+            result = is_float ? builder_.CreateFMulReduce(llvm::ConstantFP::get(llvm_element_type, 1.0), vector)
+                              : builder_.CreateMulReduce(vector);
+            break;
+        }
+        case BuiltinMember::Minimum:
+        {
+            result = is_float ? builder_.CreateFPMinReduce(vector) : builder_.CreateIntMinReduce(vector, is_signed);
+            break;
+        }
+        case BuiltinMember::Maximum:
+        {
+            result = is_float ? builder_.CreateFPMaxReduce(vector) : builder_.CreateIntMaxReduce(vector, is_signed);
+            break;
+        }
+        case BuiltinMember::Any:
+        {
+            result = builder_.CreateOrReduce(vector);
+            break;
+        }
+        case BuiltinMember::All:
+        {
+            result = builder_.CreateAndReduce(vector);
+            break;
+        }
+        case BuiltinMember::Length:
+        {
+            throw GeneratorError("Generator::GenerateBuiltinMember(): Length is not a reduction.");
+        }
+    }
+    result_store_.SetResult(result);
+}
+
+void Generator::Visit(const Call& call)
+{
+    llvm::Value* result_address = std::exchange(in_place_result_address_, nullptr);
+
+    call.function->Accept(*this);
+
+    auto function_type = dynamic_pointer_cast<FunctionType>(call.function->type);
+    llvm::Type* return_type = type_converter_.GetValueDeclarationType(*function_type->return_type);
+    const bool returns_large_aggregate = type_converter_.IsLargeAggregate(*function_type->return_type);
+    if (returns_large_aggregate && !result_address)
+    {
+        result_address = GenerateAlloca(builder_, return_type, "calltmp_result");
+    }
+
+    std::vector<llvm::Value*> arguments{};
+    if (returns_large_aggregate)
+    {
+        arguments.push_back(result_address);
+    }
+    if (call.is_method_call)
+    {
+        arguments.push_back(result_store_.GetObjectPointer());
+    }
+
+    // a void call must not be named
+    const std::string call_name = returns_large_aggregate ? "" : "calltmp";
+
+    llvm::CallInst* llvm_call = nullptr;
+    llvm::Value* llvm_function;
+    llvm::Value* context;
+    if (result_store_.HasResultAddress())
+    {
+        llvm::Value* closure_ptr = result_store_.GetResultAddress();
+
+        if (auto direct_callee = GetDirectCallee(closure_ptr))
+        {
+            GenerateArguments(call, *function_type, arguments);
+            llvm_call = builder_.CreateCall(direct_callee, arguments, call_name);
+            llvm_call->setCallingConv(direct_callee->getCallingConv());
+        }
+        else
+        {
+            const std::string& closure_name =
+                result_store_.HasObjectPointer()
+                    ? std::format(
+                          "{}.{}", result_store_.GetObjectPointer()->getName().str(), closure_ptr->getName().str()
+                      )
+                    : closure_ptr->getName().str();
+
+            auto function_address = builder_.CreateConstGEP2_32(
+                closure_type_, closure_ptr, 0, 0, std::format("geptmp_{}_function", closure_name)
+            );
+            auto context_address = builder_.CreateConstGEP2_32(
+                closure_type_, closure_ptr, 0, 1, std::format("geptmp_{}_context", closure_name)
+            );
+
+            llvm_function =
+                builder_.CreateLoad(pointer_type_, function_address, std::format("{}_function", closure_name));
+            context = builder_.CreateLoad(pointer_type_, context_address, std::format("{}_context", closure_name));
+        }
+    }
+    else
+    {
+        // closures that only exist as values (temporaries and locals kept in registers) need not be spilled
+        llvm::Value* closure = result_store_.GetResult();
+        llvm_function = builder_.CreateExtractValue(closure, 0, std::format("{}_function", closure->getName().str()));
+        context = builder_.CreateExtractValue(closure, 1, std::format("{}_context", closure->getName().str()));
+    }
+
+    if (!llvm_call)
+    {
+        llvm::FunctionType* llvm_function_type = type_converter_.GetFunctionDeclarationType(*function_type);
+
+        GenerateArguments(call, *function_type, arguments);
+        arguments.push_back(context);
+
+        llvm_call = builder_.CreateCall(llvm_function_type, llvm_function, arguments, call_name);
+        llvm_call->setCallingConv(llvm::CallingConv::Fast);
+    }
+
+    if (!returns_large_aggregate)
+    {
+        result_store_.SetResult(llvm_call);
+        return;
     }
-    else
+    llvm_call->addParamAttr(0, llvm::Attribute::getWithStructRetType(context_, return_type));
+    result_store_.SetResultAddress(result_address, return_type);
+}
+
+void Generator::GenerateArguments(const Call& call, const FunctionType& type, std::vector<llvm::Value*>& arguments)
+{
+    // the object of a method call has already been passed as the first parameter
+    auto parameter_types = *type.parameters | std::views::drop(call.is_method_call ? 1 : 0);
+    for (const auto& [argument, parameter_type] : std::views::zip(*call.arguments, parameter_types))
     {
-        auto member = member_accessor.dereferenced_object_type->GetMember(member_accessor.member);
-        auto static_initializer =
-            member_accessor.dereferenced_object_type_scope->GetLLVMValue(*member->default_initializer_global_name);
-        auto static_initializer_as_global = llvm::dyn_cast<llvm::GlobalVariable>(static_initializer);
-        if (!static_initializer_as_global)
+        argument->Accept(*this);
+        if (!type_converter_.IsLargeAggregate(*parameter_type))
         {
-            throw GeneratorError(std::format("Static initializer for {} is not a global variable.", member->name));
+            arguments.push_back(result_store_.GetResult());
+            continue;
         }
-        VisitGlobal(static_initializer_as_global);
-    }
 
-    result_store_.SetObjectPointerNoOverride(object_ptr);
+        // large arguments are passed as pointers to copies owned by the call; temporaries, i.e. the results of calls
+        // and initializers, are used as such copies directly, and so are immutable variables passed for immutable
+        // parameters, since neither caller nor callee can change them
+        auto variable = dynamic_pointer_cast<Variable>(argument);
+        const bool is_shared = variable && variable->type->mutability == TypeQualifier::Constant
+                            && parameter_type->mutability == TypeQualifier::Constant;
+        if (is_shared || dynamic_pointer_cast<Call>(argument) || dynamic_pointer_cast<Initializer>(argument))
+        {
+            arguments.push_back(result_store_.GetResultAddress());
+            continue;
+        }
+        auto copy = GenerateAlloca(builder_, type_converter_.GetValueDeclarationType(*parameter_type), "argtmp");
+        StoreResult(copy, *parameter_type);
+        arguments.push_back(copy);
+    }
 }
 
-void Generator::Visit(const Call& call)
+bool Generator::IsConstructedInPlace(const Expression& expression) const
 {
-    call.function->Accept(*this);
-    llvm::Value* closure_ptr = result_store_.GetResultAddress();
-
-    const std::string& closure_name =
-        result_store_.HasObjectPointer()
-            ? std::format("{}.{}", result_store_.GetObjectPointer()->getName().str(), closure_ptr->getName().str())
-            : closure_ptr->getName().str();
-
-    auto function_address =
-        builder_.CreateConstGEP2_32(closure_type_, closure_ptr, 0, 0, std::format("geptmp_{}_function", closure_name));
-    auto context_address =
-        builder_.CreateConstGEP2_32(closure_type_, closure_ptr, 0, 1, std::format("geptmp_{}_context", closure_name));
-
-    auto llvm_function = builder_.CreateLoad(pointer_type_, function_address, std::format("{}_function", closure_name));
-    auto context = builder_.CreateLoad(pointer_type_, context_address, std::format("{}_context", closure_name));
-
-    auto function_type = dynamic_pointer_cast<FunctionType>(call.function->type);
-    llvm::FunctionType* llvm_function_type = type_converter_.GetFunctionDeclarationType(*function_type);
+    return dynamic_cast<const Call*>(&expression) || dynamic_cast<const Initializer*>(&expression);
+}
 
-    std::vector<llvm::Value*> arguments{};
-    if (call.is_method_call)
+void Generator::StoreResult(llvm::Value* address, const Type& type)
+{
+    // results that have been constructed in place need no copy at all
+    if (result_store_.HasResultAddress() && result_store_.GetResultAddress() == address)
     {
-        arguments.push_back(result_store_.GetObjectPointer());
+        return;
     }
-    for (auto& argument : *call.arguments)
+
+    if (!type_converter_.IsLargeAggregate(type) || !result_store_.HasResultAddress())
     {
-        argument->Accept(*this);
-        arguments.push_back(result_store_.GetResult());
+        builder_.CreateStore(result_store_.GetResult(), address);
+        return;
     }
-    arguments.push_back(context);
 
-    auto llvm_call = builder_.CreateCall(llvm_function_type, llvm_function, arguments, "calltmp");
-    result_store_.SetResult(llvm_call);
+    // LLVM handles loads and stores of large aggregates badly, so they are copied in memory instead
+    auto size = llvm::ConstantExpr::getSizeOf(type_converter_.GetValueDeclarationType(type));
+    builder_.CreateMemCpy(
+        address, llvm::MaybeAlign{}, result_store_.GetResultAddress(), llvm::MaybeAlign{}, size
+    );
 }
 
 void Generator::Visit(const UnitLiteral& literal)
@@ -696,7 +1519,16 @@ void Generator::Visit(const BooleanLiteral& literal)
 
 void Generator::Visit(const IntegerLiteral& literal)
 {
-    auto result = llvm::ConstantInt::get(int_type_, literal.value);
+    auto integer_type = dynamic_pointer_cast<IntegerType>(literal.type);
+    auto llvm_type = type_converter_.Convert(*integer_type);
+    auto result = llvm::ConstantInt::get(llvm_type, literal.value, integer_type->is_signed);
+    result_store_.SetResult(result);
+}
+
+void Generator::Visit(const FloatLiteral& literal)
+{
+    auto llvm_type = type_converter_.Convert(*literal.type);
+    auto result = llvm::ConstantFP::get(llvm_type, literal.value);
     result_store_.SetResult(result);
 }
 
@@ -714,7 +1546,8 @@ void Generator::Visit(const StringLiteral& literal)
 
 void Generator::Visit(const Function& function)
 {
-    if (!function.global_name)
+    const bool is_callable = function.global_name.has_value();
+    if (!is_callable)
     {
         function.global_name = GetLambdaName();
     }
@@ -722,7 +1555,11 @@ void Generator::Visit(const Function& function)
     llvm::Function* closure_function = llvm_module_->getFunction(function.global_name.value());
     llvm::Value* closure_context_ptr = nullptr;
 
-    if (!closure_function)
+    if (closure_function && is_callable)
+    {
+        closure_function = GenerateClosureAdapter(*closure_function);
+    }
+    else if (!closure_function)
     {
         llvm::StructType* context_struct = nullptr;
         if (function.captures)
@@ -734,6 +1571,8 @@ void Generator::Visit(const Function& function)
         auto llvm_type = type_converter_.GetFunctionDeclarationType(*type);
         auto linkage = llvm::GlobalValue::LinkageTypes::ExternalLinkage;
         closure_function = llvm::Function::Create(llvm_type, linkage, function.global_name.value(), llvm_module_);
+        closure_function->setCallingConv(llvm::CallingConv::Fast);
+        AddParameterAttributes(*closure_function, *type);
 
         GenerateFunctionBody(function, *closure_function, context_struct);
     }
@@ -749,19 +1588,14 @@ void Generator::Visit(const Function& function)
     }
     else
     {
-        auto closure_address =
-            GenerateAlloca(builder_, closure_type_, std::format("address_{}", function.global_name.value()));
-
-        auto closure_function_address = builder_.CreateConstGEP2_32(
-            closure_type_, closure_address, 0, 0, std::format("geptmp_{}_function", function.global_name.value())
+        llvm::Value* closure = llvm::ConstantStruct::get(
+            closure_type_, {closure_function, llvm::ConstantPointerNull::get(pointer_type_)}
         );
-        auto closure_context_address = builder_.CreateConstGEP2_32(
-            closure_type_, closure_address, 0, 1, std::format("geptmp_{}_captures", function.global_name.value())
+        closure = builder_.CreateInsertValue(
+            closure, closure_context_ptr, 1, std::format("closure_{}", function.global_name.value())
         );
-        builder_.CreateStore(closure_function, closure_function_address);
-        builder_.CreateStore(closure_context_ptr, closure_context_address);
 
-        result_store_.SetResultAddress(closure_address, closure_type_);
+        result_store_.SetResult(closure);
     }
 }
 
@@ -777,8 +1611,13 @@ void Generator::Visit(const Initializer& initializer)
 
     const std::string object_name = std::format("init_{}", struct_type->identifier.ToString());
 
+    // all member values are computed before the first of them is stored, so the object can be constructed in place
     llvm::Type* llvm_type = type_converter_.Convert(*initializer.type);
-    auto alloca = GenerateAlloca(builder_, llvm_type, std::format("address_{}", object_name));
+    llvm::Value* alloca = std::exchange(in_place_result_address_, nullptr);
+    if (!alloca)
+    {
+        alloca = GenerateAlloca(builder_, llvm_type, std::format("address_{}", object_name));
+    }
 
     auto actual_initializers =
         GetActualMemberInitializers(*initializer.member_initializers, *struct_type, *initializer.type_scope);
@@ -804,33 +1643,260 @@ void Generator::Visit(const Allocation& allocation)
     llvm::Type* allocated_llvm_type = type_converter_.Convert(*allocation.allocated_type);
     llvm::Value* type_size = llvm::ConstantInt::get(int_type_, data_layout_.getTypeAllocSize(allocated_llvm_type));
 
-    llvm::Value* size_to_allocate;
+    llvm::Value* array_size{nullptr};
     if (allocation.size)
     {
         allocation.size->Accept(*this);
-        auto array_size = result_store_.GetResult();
-        size_to_allocate = builder_.CreateMul(type_size, array_size);
+        array_size = result_store_.GetResult();
     }
-    else
+
+    if (allocation.is_uninitialized)
     {
-        size_to_allocate = type_size;
+        auto size_to_allocate = array_size ? builder_.CreateMul(type_size, array_size) : type_size;
+        result_store_.SetResult(GenerateMallocCall(size_to_allocate, "allocated"));
+        return;
     }
+
     allocation.initial_value->Accept(*this);
+
+    if (!array_size)
+    {
+        auto allocated_memory = GenerateMallocCall(type_size, "allocated");
+        StoreResult(allocated_memory, *allocation.allocated_type);
+        result_store_.SetResult(allocated_memory);
+        return;
+    }
+
     auto initial_value = result_store_.GetResult();
 
+    auto constant_initial_value = llvm::dyn_cast<llvm::Constant>(initial_value);
+    if (constant_initial_value && constant_initial_value->isNullValue())
+    {
+        result_store_.SetResult(GenerateCallocCall(array_size, type_size, "allocated"));
+        return;
+    }
+
+    auto size_to_allocate = builder_.CreateMul(type_size, array_size);
     auto allocated_memory = GenerateMallocCall(size_to_allocate, "allocated");
 
-    // TODO use loop + GEP for array initialization
-    builder_.CreateStore(initial_value, allocated_memory);
+    if (llvm::Value* byte_value = llvm::isBytewiseValue(initial_value, data_layout_);
+        byte_value && llvm::isa<llvm::ConstantInt>(byte_value))
+    {
+        builder_.CreateMemSet(allocated_memory, byte_value, size_to_allocate, llvm::MaybeAlign{});
+    }
+    else
+    {
+        GenerateArrayFill(allocated_llvm_type, allocated_memory, array_size, initial_value);
+    }
+
     result_store_.SetResult(allocated_memory);
 }
 
+void Generator::Visit(const Conversion& conversion)
+{
+    conversion.operand->Accept(*this);
+    llvm::Value* operand = result_store_.GetResult();
+
+    const auto& source = *conversion.operand->type;
+    const auto& target = *conversion.type;
+    auto source_vector = dynamic_cast<const VectorType*>(&source);
+    auto target_vector = dynamic_cast<const VectorType*>(&target);
+
+    llvm::Value* result;
+    if (dynamic_cast<const ArrayType*>(&source) || dynamic_cast<const ArrayType*>(&target))
+    {
+        // arrays and vectors of the same element type are converted element by element
+        result = llvm::PoisonValue::get(type_converter_.Convert(target));
+        for (auto index : std::views::iota(0u, *GetFixedLength(source)))
+        {
+            auto element = source_vector ? builder_.CreateExtractElement(operand, index, "lanetmp")
+                                         : builder_.CreateExtractValue(operand, index, "elementtmp");
+            result = target_vector ? builder_.CreateInsertElement(result, element, index, "vectortmp")
+                                   : builder_.CreateInsertValue(result, element, index, "arraytmp");
+        }
+    }
+    else if (target_vector && !source_vector)
+    {
+        auto element = GenerateCast(operand, source, *target_vector->element_type);
+        result = builder_.CreateVectorSplat(target_vector->lanes, element, "splattmp");
+    }
+    else if (source_vector && !target_vector)
+    {
+        // the lanes of a mask become the bits of an integer, starting with the least significant one
+        auto bits = builder_.CreateBitCast(operand, builder_.getIntNTy(source_vector->lanes), "masktmp");
+        result = builder_.CreateZExt(bits, type_converter_.Convert(target), "convtmp");
+    }
+    else
+    {
+        result = GenerateCast(operand, source, target);
+    }
+    result_store_.SetResult(result);
+}
+
+llvm::Value* Generator::GenerateCast(llvm::Value* operand, const Type& source, const Type& target)
+{
+    // only signed integers are sign-extended, while characters, booleans and enum members are non-negative; the
+    // signedness of integers also selects between the signed and unsigned conversions from and to floating-point.
+    // Vectors are converted lane-wise.
+    auto source_vector = dynamic_cast<const VectorType*>(&source);
+    auto target_vector = dynamic_cast<const VectorType*>(&target);
+    auto source_type = dynamic_cast<const IntegerType*>(source_vector ? source_vector->element_type.get() : &source);
+    bool is_signed = source_type && source_type->is_signed;
+    auto integer_target_type =
+        dynamic_cast<const IntegerType*>(target_vector ? target_vector->element_type.get() : &target);
+    bool is_target_signed = !integer_target_type || integer_target_type->is_signed;
+    auto target_type = type_converter_.Convert(target);
+    auto opcode = llvm::CastInst::getCastOpcode(operand, is_signed, target_type, is_target_signed);
+    return builder_.CreateCast(opcode, operand, target_type, "convtmp");
+}
+
+void Generator::Visit(const ElementAccessor& element_accessor)
+{
+    auto llvm_element_type = type_converter_.GetValueDeclarationType(*element_accessor.type);
+
+    element_accessor.dereferenced_object->Accept(*this);
+    if (element_accessor.shuffle_mask)
+    {
+        auto vector = result_store_.GetResult();
+        result_store_.SetResult(builder_.CreateShuffleVector(vector, *element_accessor.shuffle_mask, "shuffletmp"));
+        return;
+    }
+
+    if (dynamic_pointer_cast<SliceType>(element_accessor.dereferenced_object_type))
+    {
+        auto slice = result_store_.GetResult();
+        auto elements_ptr = builder_.CreateExtractValue(slice, 0, "elementstmp");
+        auto length = builder_.CreateExtractValue(slice, 1, "lentmp");
+
+        auto index = GenerateIndex(*element_accessor.index);
+        if (options_.bounds_checks && element_accessor.needs_bounds_check)
+        {
+            GenerateBoundsCheck(builder_.CreateICmpULT(index, length, "inboundstmp"));
+        }
+
+        auto element_address = builder_.CreateInBoundsGEP(llvm_element_type, elements_ptr, index, "geptmp_slice");
+        result_store_.SetResultAddress(element_address, llvm_element_type);
+        return;
+    }
+
+    // lanes of vectors are addressed like elements of arrays
+    auto array_ptr = result_store_.GetResultAddress();
+    auto length = *GetFixedLength(*element_accessor.dereferenced_object_type);
+
+    auto index = GenerateIndex(*element_accessor.index);
+    if (options_.bounds_checks && element_accessor.needs_bounds_check)
+    {
+        GenerateBoundsCheck(builder_.CreateICmpULT(index, builder_.getInt64(length), "inboundstmp"));
+    }
+
+    auto llvm_array_type = type_converter_.Convert(*element_accessor.dereferenced_object_type);
+    auto element_address = builder_.CreateInBoundsGEP(
+        llvm_array_type,
+        array_ptr,
+        {builder_.getInt64(0), index},
+        std::format("geptmp_{}", array_ptr->getName().str())
+    );
+
+    result_store_.SetResultAddress(element_address, llvm_element_type);
+}
+
+void Generator::Visit(const ArrayLiteral& array_literal)
+{
+    auto llvm_array_type = llvm::dyn_cast<llvm::ArrayType>(type_converter_.Convert(*array_literal.type));
+
+    std::vector<llvm::Value*> elements{};
+    for (const auto& element : *array_literal.elements)
+    {
+        element->Accept(*this);
+        elements.push_back(result_store_.GetResult());
+    }
+    if (array_literal.repetitions)
+    {
+        elements.resize(*array_literal.repetitions, elements.front());
+    }
+
+    // arrays of constants, e.g. the initializers of globals, are constants themselves
+    if (std::ranges::all_of(elements, [](auto element) { return llvm::isa<llvm::Constant>(element); }))
+    {
+        auto constants = elements
+                       | std::views::transform([](auto element) { return llvm::cast<llvm::Constant>(element); })
+                       | std::ranges::to<std::vector>();
+        result_store_.SetResult(llvm::ConstantArray::get(llvm_array_type, constants));
+        return;
+    }
+
+    llvm::Value* array = llvm::PoisonValue::get(llvm_array_type);
+    for (auto index : std::views::iota(0u, elements.size()))
+    {
+        array = builder_.CreateInsertValue(array, elements.at(index), index, "arraytmp");
+    }
+    result_store_.SetResult(array);
+}
+
+void Generator::Visit(const Slicing& slicing)
+{
+    auto slice_type = dynamic_pointer_cast<SliceType>(slicing.type);
+    auto llvm_element_type = type_converter_.GetValueDeclarationType(*slice_type->element_type);
+
+    // the address of the first element and, except for references, the number of elements of the sliced object
+    llvm::Value* elements_ptr;
+    llvm::Value* length = nullptr;
+    slicing.dereferenced_object->Accept(*this);
+    if (auto array_type = dynamic_pointer_cast<ArrayType>(slicing.dereferenced_object_type))
+    {
+        auto array_ptr = result_store_.GetResultAddress();
+        elements_ptr = builder_.CreateConstInBoundsGEP2_64(type_converter_.Convert(*array_type), array_ptr, 0, 0);
+        length = builder_.getInt64(array_type->length);
+    }
+    else if (dynamic_pointer_cast<SliceType>(slicing.dereferenced_object_type))
+    {
+        auto slice = result_store_.GetResult();
+        elements_ptr = builder_.CreateExtractValue(slice, 0, "elementstmp");
+        length = builder_.CreateExtractValue(slice, 1, "lentmp");
+    }
+    else
+    {
+        elements_ptr = result_store_.GetResult();
+    }
+
+    auto lower = slicing.lower ? GenerateIndex(*slicing.lower) : builder_.getInt64(0);
+    auto upper = slicing.upper ? GenerateIndex(*slicing.upper) : length;
+
+    if (options_.bounds_checks && slicing.needs_bounds_check)
+    {
+        auto is_in_bounds = length ? builder_.CreateAnd(
+                                         builder_.CreateICmpULE(lower, upper, "inboundstmp"),
+                                         builder_.CreateICmpULE(upper, length, "inboundstmp"),
+                                         "inboundstmp"
+                                     )
+                                   : builder_.CreateICmpSLE(lower, upper, "inboundstmp");
+        GenerateBoundsCheck(is_in_bounds);
+    }
+
+    llvm::Value* slice = llvm::PoisonValue::get(type_converter_.GetSliceType());
+    slice = builder_.CreateInsertValue(
+        slice, builder_.CreateInBoundsGEP(llvm_element_type, elements_ptr, lower, "geptmp_slice"), 0, "slicetmp"
+    );
+    slice = builder_.CreateInsertValue(slice, builder_.CreateSub(upper, lower, "lentmp"), 1, "slicetmp");
+    result_store_.SetResult(slice);
+}
+
 void Generator::GenerateFunctionBody(
     const Function& function, llvm::Function& llvm_function, llvm::StructType* context_struct
 )
 {
     llvm::BasicBlock* previous_block = builder_.GetInsertBlock();
 
+    // fast-math flags let LLVM reassociate floating-point operations, e.g. to vectorize reductions; the guard restores
+    // the flags of an enclosing function
+    llvm::IRBuilderBase::FastMathFlagGuard fast_math_guard{builder_};
+    llvm::FastMathFlags fast_math_flags{};
+    if (options_.fast_math || function.is_fast_math)
+    {
+        fast_math_flags.setFast();
+    }
+    builder_.setFastMathFlags(fast_math_flags);
+
     llvm::BasicBlock* allocas_block = llvm::BasicBlock::Create(context_, kAllocationBlockName, &llvm_function);
     llvm::BasicBlock* entry_block = llvm::BasicBlock::Create(context_, kEntryBlockName, &llvm_function);
 
@@ -850,11 +1916,27 @@ void Generator::GenerateFunctionBody(
         }
     }
 
-    // Fill local scope with arguments
+    // Fill local scope with arguments, which follow the address for a large result
+    const std::size_t first_parameter = type_converter_.IsLargeAggregate(*function_type->return_type) ? 1 : 0;
     for (std::size_t i = 0; i < function.parameters->size(); ++i)
     {
         ParameterDeclaration& param = *function.parameters->at(i);
-        llvm::Argument* llvm_param = llvm_function.args().begin() + i;
+        llvm::Argument* llvm_param = llvm_function.args().begin() + first_parameter + i;
+
+        // large arguments point to copies owned by the call, which the function can use as its own
+        if (type_converter_.IsLargeAggregate(*function_type->parameters->at(i)))
+        {
+            llvm_param->setName(param.name);
+            function.locals->SetLLVMValue(param.name, llvm_param);
+            continue;
+        }
+
+        if (KeepInRegister(*function_type->parameters->at(i)))
+        {
+            llvm_param->setName(param.name);
+            function.locals->SetLLVMValue(param.name, llvm_param, false);
+            continue;
+        }
 
         auto param_type = type_converter_.GetValueDeclarationType(*function_type->parameters->at(i));
 
@@ -869,11 +1951,49 @@ void Generator::GenerateFunctionBody(
     builder_.SetInsertPoint(allocas_block);
     builder_.CreateBr(entry_block);
 
+    MarkTailCalls(llvm_function);
+
     llvm::verifyFunction(llvm_function);
 
     builder_.SetInsertPoint(previous_block);
 }
 
+llvm::Value* Generator::MaskShiftAmount(llvm::Value* amount)
+{
+    // LLVM shifts by at least the bit width are poison; like the constant evaluator, take the amount modulo the width,
+    // which the masking shift instructions of common targets do for free
+    auto width = amount->getType()->getScalarSizeInBits();
+    return builder_.CreateAnd(amount, width - 1, "shamttmp");
+}
+
+llvm::Value* Generator::GenerateIndex(const Expression& index)
+{
+    index.Accept(*this);
+    auto index_type = dynamic_pointer_cast<IntegerType>(index.type);
+    return builder_.CreateIntCast(result_store_.GetResult(), builder_.getInt64Ty(), index_type->is_signed, "indextmp");
+}
+
+void Generator::GenerateBoundsCheck(llvm::Value* is_in_bounds)
+{
+    llvm::Function* llvm_function = builder_.GetInsertBlock()->getParent();
+    llvm::BasicBlock* fail_block = llvm::BasicBlock::Create(context_, "boundsfail", llvm_function);
+    llvm::BasicBlock* ok_block = llvm::BasicBlock::Create(context_, "boundsok", llvm_function);
+    builder_.CreateCondBr(is_in_bounds, ok_block, fail_block);
+
+    builder_.SetInsertPoint(fail_block);
+    builder_.CreateIntrinsic(llvm::Intrinsic::trap, {}, {});
+    builder_.CreateUnreachable();
+
+    builder_.SetInsertPoint(ok_block);
+}
+
+bool Generator::KeepInRegister(const Type& type) const
+{
+    // structs and arrays stay in memory, since member accesses, method calls and indexing need their address
+    return options_.keep_constants_in_registers && type.mutability == TypeQualifier::Constant
+        && !dynamic_cast<const StructType*>(&type) && !dynamic_cast<const ArrayType*>(&type);
+}
+
 std::vector<std::tuple<std::string, llvm::Value*>> Generator::GetActualMemberInitializers(
     const MemberInitializerList& explicit_initializers, const StructType& struct_type, const Scope& scope
 )
@@ -929,22 +2049,14 @@ llvm::StructType* Generator::GenerateClosureContextStruct(const Function& functi
 
     auto closure_context_struct =
         llvm::StructType::create(context_, std::format("__context__{}", *function.global_name));
-    closure_context_struct->setBody(capture_types, true);
+    closure_context_struct->setBody(capture_types);
 
     return closure_context_struct;
 }
 
 void Generator::VisitGlobal(llvm::GlobalVariable* global_variable)
 {
-    auto llvm_type = global_variable->getValueType();
-    if (llvm::isa<llvm::ArrayType>(llvm_type))
-    {
-        result_store_.SetResult(global_variable);
-    }
-    else
-    {
-        result_store_.SetResultAddress(global_variable, llvm_type);
-    }
+    result_store_.SetResultAddress(global_variable, global_variable->getValueType());
 }
 
 llvm::Value* Generator::GenerateMallocCall(llvm::Value* size, const std::string& name)
@@ -955,13 +2067,58 @@ llvm::Value* Generator::GenerateMallocCall(llvm::Value* size, const std::string&
     return builder_.CreateCall(int_to_ptr, malloc_function, {size}, name);
 }
 
+llvm::Value* Generator::GenerateCallocCall(llvm::Value* count, llvm::Value* size, const std::string& name)
+{
+    llvm::FunctionType* int_int_to_ptr = llvm::FunctionType::get(pointer_type_, {int_type_, int_type_}, false);
+    llvm::Function* calloc_function =
+        llvm::dyn_cast<llvm::Function>(llvm_module_->getOrInsertFunction("calloc", int_int_to_ptr).getCallee());
+    return builder_.CreateCall(int_int_to_ptr, calloc_function, {count, size}, name);
+}
+
+void Generator::GenerateArrayFill(
+    llvm::Type* element_type, llvm::Value* array, llvm::Value* array_size, llvm::Value* value
+)
+{
+    llvm::Function* llvm_function = builder_.GetInsertBlock()->getParent();
+    llvm::BasicBlock* preheader = builder_.GetInsertBlock();
+    llvm::BasicBlock* body = llvm::BasicBlock::Create(context_, "fillbody", llvm_function);
+    llvm::BasicBlock* afterfill = llvm::BasicBlock::Create(context_, "afterfill");
+
+    auto zero = llvm::ConstantInt::get(int_type_, 0);
+    auto is_empty = builder_.CreateICmpSLE(array_size, zero, "fill_isempty");
+    builder_.CreateCondBr(is_empty, afterfill, body);
+
+    // body: a single store per iteration with a canonical induction variable, so that the loop vectorizer applies
+    builder_.SetInsertPoint(body);
+    auto index = builder_.CreatePHI(int_type_, 2, "fill_index");
+    index->addIncoming(zero, preheader);
+    auto element_address = builder_.CreateGEP(element_type, array, {index}, "fill_address");
+    builder_.CreateStore(value, element_address);
+    auto next_index = builder_.CreateAdd(index, llvm::ConstantInt::get(int_type_, 1), "fill_next", true, true);
+    index->addIncoming(next_index, body);
+    auto is_done = builder_.CreateICmpEQ(next_index, array_size, "fill_isdone");
+    builder_.CreateCondBr(is_done, afterfill, body);
+
+    // afterfill
+    llvm_function->insert(llvm_function->end(), afterfill);
+    builder_.SetInsertPoint(afterfill);
+}
+
 std::tuple<llvm::Value*, llvm::StructType*> Generator::GenerateClosureContext(const Function& function)
 {
     auto context_struct = GenerateClosureContextStruct(function);
 
-    llvm::Value* context_size = llvm::ConstantInt::get(int_type_, data_layout_.getTypeAllocSize(context_struct));
-    auto context_address =
-        GenerateMallocCall(context_size, std::format("address_{}_context", function.global_name.value()));
+    const auto context_name = std::format("address_{}_context", function.global_name.value());
+    llvm::Value* context_address;
+    if (function.context_may_escape)
+    {
+        llvm::Value* context_size = llvm::ConstantInt::get(int_type_, data_layout_.getTypeAllocSize(context_struct));
+        context_address = GenerateMallocCall(context_size, context_name);
+    }
+    else
+    {
+        context_address = GenerateAlloca(builder_, context_struct, context_name);
+    }
 
     for (auto capture_index : std::views::iota(std::size_t{0}, function.captures->size()))
     {
@@ -982,6 +2139,147 @@ std::tuple<llvm::Value*, llvm::StructType*> Generator::GenerateClosureContext(co
     return {context_address, context_struct};
 }
 
+llvm::Function* Generator::GenerateClosureAdapter(llvm::Function& function)
+{
+    std::vector<llvm::Type*> param_types{function.getFunctionType()->params()};
+    param_types.push_back(pointer_type_);
+    auto adapter_type = llvm::FunctionType::get(function.getReturnType(), param_types, false);
+
+    auto adapter = llvm::Function::Create(
+        adapter_type,
+        llvm::GlobalValue::LinkageTypes::PrivateLinkage,
+        std::format("__closure__{}", function.getName().str()),
+        llvm_module_
+    );
+    adapter->setCallingConv(llvm::CallingConv::Fast);
+
+    llvm::BasicBlock* previous_block = builder_.GetInsertBlock();
+    builder_.SetInsertPoint(llvm::BasicBlock::Create(context_, kEntryBlockName, adapter));
+
+    std::vector<llvm::Value*> arguments{};
+    for (auto& argument : adapter->args() | std::views::take(function.arg_size()))
+    {
+        arguments.push_back(&argument);
+    }
+    if (function.getReturnType()->isVoidTy())
+    {
+        builder_.CreateCall(&function, arguments)->setCallingConv(function.getCallingConv());
+        builder_.CreateRetVoid();
+    }
+    else
+    {
+        auto call = builder_.CreateCall(&function, arguments, "calltmp");
+        call->setCallingConv(function.getCallingConv());
+        builder_.CreateRet(call);
+    }
+
+    if (previous_block)
+    {
+        builder_.SetInsertPoint(previous_block);
+    }
+    else
+    {
+        builder_.ClearInsertionPoint();
+    }
+
+    adapted_functions_.emplace(adapter, &function);
+    return adapter;
+}
+
+llvm::Function* Generator::GetDirectCallee(llvm::Value* closure_address)
+{
+    auto global_variable = llvm::dyn_cast<llvm::GlobalVariable>(closure_address);
+    if (!global_variable)
+    {
+        return nullptr;
+    }
+
+    auto imported_function = imported_functions_.find(global_variable);
+    if (imported_function != imported_functions_.end())
+    {
+        return imported_function->second;
+    }
+
+    if (!global_variable->isConstant() || !global_variable->hasInitializer())
+    {
+        return nullptr;
+    }
+
+    auto closure = llvm::dyn_cast<llvm::ConstantStruct>(global_variable->getInitializer());
+    if (!closure || closure->getType() != closure_type_)
+    {
+        return nullptr;
+    }
+
+    auto adapted_function = adapted_functions_.find(llvm::dyn_cast<llvm::Function>(closure->getOperand(0)));
+    return (adapted_function != adapted_functions_.end()) ? adapted_function->second : nullptr;
+}
+
+bool Generator::IsTailCallCompatible(const llvm::CallInst& call) const
+{
+    // the call must be the last instruction before the return
+    const llvm::Function& caller = *call.getFunction();
+    return &call == &builder_.GetInsertBlock()->back() && call.getFunctionType() == caller.getFunctionType()
+        && call.getCallingConv() == caller.getCallingConv();
+}
+
+static bool AddressMayEscape(const llvm::Value& address)
+{
+    for (const llvm::User* user : address.users())
+    {
+        if (llvm::isa<llvm::LoadInst>(user))
+        {
+            continue;
+        }
+        if (auto store = llvm::dyn_cast<llvm::StoreInst>(user); store && store->getValueOperand() != &address)
+        {
+            continue;
+        }
+        if (llvm::isa<llvm::GetElementPtrInst>(user) && !AddressMayEscape(*user))
+        {
+            continue;
+        }
+        return true;
+    }
+    return false;
+}
+
+void Generator::MarkTailCalls(llvm::Function& llvm_function)
+{
+    // tail calls of enclosing functions are still pending while a lambda is generated
+    auto others = std::ranges::partition(
+        tail_calls_, [&](const TailCall& tail_call) { return tail_call.call->getFunction() == &llvm_function; }
+    );
+    std::vector<TailCall> tail_calls{tail_calls_.begin(), others.begin()};
+    tail_calls_.erase(tail_calls_.begin(), others.begin());
+    if (tail_calls.empty())
+    {
+        return;
+    }
+
+    // the callee would otherwise access a stack frame that has already been released
+    bool stack_address_may_escape = std::ranges::any_of(
+        llvm::instructions(llvm_function),
+        [](const llvm::Instruction& instruction)
+        { return llvm::isa<llvm::AllocaInst>(instruction) && AddressMayEscape(instruction); }
+    );
+
+    for (const auto& tail_call : tail_calls)
+    {
+        if (!stack_address_may_escape)
+        {
+            tail_call.call->setTailCallKind(llvm::CallInst::TCK_MustTail);
+        }
+        else if (tail_call.is_explicit)
+        {
+            throw GeneratorError(std::format(
+                "Cannot guarantee tail call in function '{}', since it passes on addresses of its local variables.",
+                llvm_function.getName().str()
+            ));
+        }
+    }
+}
+
 Generator::ResultStore::ResultStore(llvm::IRBuilder<>& builder)
     : builder_{builder}
 {
@@ -1129,15 +2427,18 @@ bool Generator::ResultStore::HasObjectPointer()
     return object_ptr_;
 }
 
+bool Generator::ResultStore::HasResultAddress()
+{
+    return result_address_;
+}
+
 llvm::AllocaInst* GenerateAlloca(llvm::IRBuilder<>& builder, llvm::Type* type, std::string name)
 {
+    // GenerateFunctionBody creates the allocas block first, so it is always the entry block of the function
     llvm::Function& llvm_function = *builder.GetInsertBlock()->getParent();
+    llvm::BasicBlock& alloca_block = llvm_function.getEntryBlock();
 
-    auto alloca_block = std::ranges::find(
-        llvm_function, kAllocationBlockName, [](const llvm::BasicBlock& block) { return block.getName(); }
-    );
-
-    if (alloca_block == llvm_function.end())
+    if (alloca_block.getName() != kAllocationBlockName)
     {
         throw GeneratorError(std::format(
             "Function '{}' does not have '{}' block. This should never happen.",
@@ -1146,12 +2447,9 @@ llvm::AllocaInst* GenerateAlloca(llvm::IRBuilder<>& builder, llvm::Type* type, s
         ));
     }
 
-    auto previous_block = builder.GetInsertBlock();
-    builder.SetInsertPoint(&*alloca_block);
-    auto alloca = builder.CreateAlloca(type, nullptr, name);
-    builder.SetInsertPoint(previous_block);
-
-    return alloca;
+    llvm::IRBuilderBase::InsertPointGuard guard{builder};
+    builder.SetInsertPoint(&alloca_block);
+    return builder.CreateAlloca(type, nullptr, name);
 }
 
 }  // namespace l0::detail
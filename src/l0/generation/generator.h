@@ -7,10 +7,12 @@
 #include <llvm/IR/Value.h>
 
 #include <string>
+#include <unordered_map>
 
 #include "l0/ast/expression.h"
 #include "l0/ast/module.h"
 #include "l0/ast/statement.h"
+#include "l0/generation/generation.h"
 #include "l0/generation/type_converter.h"
 
 namespace l0::detail
@@ -19,12 +21,13 @@ namespace l0::detail
 class Generator : private IConstExpressionVisitor, IConstStatementVisitor
 {
    public:
-    Generator(llvm::LLVMContext& context, Module& module);
+    Generator(llvm::LLVMContext& context, Module& module, GeneratorOptions options = {});
 
     void Run();
 
    private:
     Module& ast_module_;
+    GeneratorOptions options_;
 
     llvm::LLVMContext& context_;
     llvm::IRBuilder<> builder_;
@@ -39,18 +42,24 @@ class Generator : private IConstExpressionVisitor, IConstStatementVisitor
 
     TypeConverter type_converter_;
 
+    void SetTarget();
     void DeclareTypes();
     void DeclareEnvironmentVariables();
     void DeclareExternalVariables();
     void DeclareGlobalVariables();
+    bool DeclareEnumMember(Scope& scope, const Identifier& symbol);
     void DeclareCallables();
     void DeclareCallable(std::shared_ptr<Function> function);
+    void AddParameterAttributes(llvm::Function& llvm_function, const FunctionType& type);
+    void AddFunctionAttributes(llvm::Function& llvm_function, const Function& function);
 
     void DefineTypes();
     void DefineStructType(const StructType& type);
-    void DefineEnumType(const EnumType& type);
+    void DefineDefaultInitializers();
+    void DefineDefaultInitializers(const StructType& type);
     void DefineGlobalVariables();
     void DefineCallables();
+    void SetGenericInstanceLinkage();
 
     void Visit(const StatementBlock& statement_block) override;
     void Visit(const Declaration& declaration) override;
@@ -58,7 +67,9 @@ class Generator : private IConstExpressionVisitor, IConstStatementVisitor
     void Visit(const ExpressionStatement& expression_statement) override;
     void Visit(const ReturnStatement& return_statement) override;
     void Visit(const ConditionalStatement& conditional_statement) override;
+    void Visit(const MatchStatement& match_statement) override;
     void Visit(const WhileLoop& while_loop) override;
+    void Visit(const ForLoop& for_loop) override;
     void Visit(const Deallocation& deallocation) override;
 
     void Visit(const Assignment& assignment) override;
@@ -70,11 +81,16 @@ class Generator : private IConstExpressionVisitor, IConstStatementVisitor
     void Visit(const UnitLiteral& literal) override;
     void Visit(const BooleanLiteral& literal) override;
     void Visit(const IntegerLiteral& literal) override;
+    void Visit(const FloatLiteral& literal) override;
     void Visit(const CharacterLiteral& literal) override;
     void Visit(const StringLiteral& literal) override;
     void Visit(const Function& function) override;
     void Visit(const Initializer& Initializer) override;
     void Visit(const Allocation& allocation) override;
+    void Visit(const Conversion& conversion) override;
+    void Visit(const ElementAccessor& element_accessor) override;
+    void Visit(const ArrayLiteral& array_literal) override;
+    void Visit(const Slicing& slicing) override;
 
     void GenerateFunctionBody(
         const Function& function, llvm::Function& llvm_function, llvm::StructType* context_struct = nullptr
@@ -87,8 +103,46 @@ class Generator : private IConstExpressionVisitor, IConstStatementVisitor
     llvm::StructType* GenerateClosureContextStruct(const Function& function);
     std::tuple<llvm::Value*, llvm::StructType*> GenerateClosureContext(const Function& function);
     void VisitGlobal(llvm::GlobalVariable* global_variable);
+    llvm::Value* MaskShiftAmount(llvm::Value* amount);
+    void GenerateBuiltinMember(const MemberAccessor& member_accessor);
+    llvm::MDNode* GenerateLoopMetadata(const ForLoop& for_loop);
+    void GenerateArguments(const Call& call, const FunctionType& type, std::vector<llvm::Value*>& arguments);
+    void StoreResult(llvm::Value* address, const Type& type);
+    llvm::Value* GenerateCast(llvm::Value* operand, const Type& source, const Type& target);
+    llvm::Value* GenerateIndex(const Expression& index);
+    void GenerateBoundsCheck(llvm::Value* is_in_bounds);
+    bool KeepInRegister(const Type& type) const;
 
     llvm::Value* GenerateMallocCall(llvm::Value* size, const std::string& name);
+    llvm::Value* GenerateCallocCall(llvm::Value* count, llvm::Value* size, const std::string& name);
+    void GenerateArrayFill(llvm::Type* element_type, llvm::Value* array, llvm::Value* array_size, llvm::Value* value);
+
+    // Global functions, methods and environment functions are generated without a context parameter and called
+    // directly wherever the callee is known statically. When used as first-class values, they are wrapped into a
+    // closure around an adapter that accepts and ignores the context. Everything that is called through a closure uses
+    // the fast calling convention. Inline functions of other modules are declared as well and called directly through
+    // their external closures.
+    std::unordered_map<llvm::Function*, llvm::Function*> adapted_functions_;
+    std::unordered_map<llvm::GlobalVariable*, llvm::Function*> imported_functions_;
+    llvm::Function* GenerateClosureAdapter(llvm::Function& function);
+    llvm::Function* GetDirectCallee(llvm::Value* closure_address);
+
+    // Calls whose result is returned immediately become musttail calls if caller and callee agree in prototype and
+    // calling convention, and the caller does not pass around addresses of its stack slots. This is guaranteed for
+    // 'return tail' statements and checked once the body of the caller is complete.
+    struct TailCall
+    {
+        llvm::CallInst* call;
+        bool is_explicit;
+    };
+    std::vector<TailCall> tail_calls_;
+
+    // The memory that a call returning a large aggregate or an initializer writes its result to, provided by the
+    // declaration or return statement whose value it is, so that the result needs not be copied; null otherwise
+    llvm::Value* in_place_result_address_{nullptr};
+    bool IsConstructedInPlace(const Expression& expression) const;
+    bool IsTailCallCompatible(const llvm::CallInst& call) const;
+    void MarkTailCalls(llvm::Function& llvm_function);
 
     class ResultStore
     {
@@ -99,6 +153,7 @@ class Generator : private IConstExpressionVisitor, IConstStatementVisitor
         llvm::Value* GetResultAddress();
         llvm::Value* GetObjectPointer();
         bool HasObjectPointer();
+        bool HasResultAddress();
 
         void Clear();
         void SetResult(llvm::Value* result);
@@ -0,0 +1,158 @@
+#include "l0/generation/inline_importer.h"
+
+#include <llvm/IR/InstIterator.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+
+#include <algorithm>
+#include <ranges>
+#include <set>
+
+namespace l0::detail
+{
+
+static void CollectReferencedGlobals(const llvm::Value* value, std::set<const llvm::GlobalValue*>& globals)
+{
+    if (auto global = llvm::dyn_cast<llvm::GlobalValue>(value))
+    {
+        globals.insert(global);
+        return;
+    }
+
+    if (auto constant = llvm::dyn_cast<llvm::Constant>(value))
+    {
+        for (const auto& operand : constant->operands())
+        {
+            CollectReferencedGlobals(operand.get(), globals);
+        }
+    }
+}
+
+InlineImporter::InlineImporter(llvm::Module& target, const llvm::Module& source)
+    : target_{target},
+      source_{source}
+{
+}
+
+void InlineImporter::Run()
+{
+    // importing a function may declare further inline functions it calls, so repeat until nothing changes
+    bool imported_any{true};
+    while (imported_any)
+    {
+        imported_any = false;
+        for (const auto& source_function : source_)
+        {
+            if (source_function.isDeclaration() || source_function.hasLocalLinkage()
+                || !source_function.hasFnAttribute(llvm::Attribute::AlwaysInline))
+            {
+                continue;
+            }
+
+            auto target_function = target_.getFunction(source_function.getName());
+            if (!target_function || !target_function->isDeclaration())
+            {
+                continue;
+            }
+
+            imported_any |= Import(source_function, *target_function);
+        }
+    }
+
+    // cloning into another module registers the (absent) debug info compile units of the source
+    auto compile_units = target_.getNamedMetadata("llvm.dbg.cu");
+    if (compile_units && compile_units->getNumOperands() == 0)
+    {
+        target_.eraseNamedMetadata(compile_units);
+    }
+}
+
+bool InlineImporter::Import(const llvm::Function& source_function, llvm::Function& target_function)
+{
+    std::set<const llvm::GlobalValue*> referenced_globals{};
+    for (const auto& instruction : llvm::instructions(source_function))
+    {
+        for (const auto& operand : instruction.operands())
+        {
+            CollectReferencedGlobals(operand.get(), referenced_globals);
+        }
+    }
+
+    // all references are checked before any of them is declared, so that a failed import leaves the target unchanged
+    if (!std::ranges::all_of(referenced_globals, [this](auto global) { return IsImportable(*global); }))
+    {
+        return false;
+    }
+
+    llvm::ValueToValueMapTy value_map{};
+    for (auto global : referenced_globals)
+    {
+        value_map[global] = GetOrDeclare(*global);
+    }
+
+    auto target_argument = target_function.arg_begin();
+    for (const auto& source_argument : source_function.args())
+    {
+        target_argument->setName(source_argument.getName());
+        value_map[&source_argument] = &*target_argument++;
+    }
+
+    llvm::SmallVector<llvm::ReturnInst*, 8> returns{};
+    llvm::CloneFunctionInto(
+        &target_function, &source_function, value_map, llvm::CloneFunctionChangeType::DifferentModule, returns
+    );
+    target_function.setLinkage(llvm::GlobalValue::AvailableExternallyLinkage);
+
+    return true;
+}
+
+bool InlineImporter::IsImportable(const llvm::GlobalValue& global) const
+{
+    // globals that are private to either module cannot be referred to from the other one
+    if (global.hasLocalLinkage())
+    {
+        return false;
+    }
+
+    auto name = global.getName();
+    if (llvm::isa<llvm::Function>(global))
+    {
+        auto existing = target_.getFunction(name);
+        return !existing || !existing->hasLocalLinkage();
+    }
+    if (llvm::isa<llvm::GlobalVariable>(global))
+    {
+        auto existing = target_.getNamedGlobal(name);
+        return !existing || !existing->hasLocalLinkage();
+    }
+    return false;
+}
+
+llvm::Constant* InlineImporter::GetOrDeclare(const llvm::GlobalValue& global)
+{
+    auto name = global.getName();
+
+    if (auto function = llvm::dyn_cast<llvm::Function>(&global))
+    {
+        if (auto existing = target_.getFunction(name))
+        {
+            return existing;
+        }
+        auto declaration = llvm::Function::Create(
+            function->getFunctionType(), llvm::GlobalValue::ExternalLinkage, name, target_
+        );
+        declaration->setCallingConv(function->getCallingConv());
+        declaration->setAttributes(function->getAttributes());
+        return declaration;
+    }
+
+    auto variable = llvm::cast<llvm::GlobalVariable>(&global);
+    if (auto existing = target_.getNamedGlobal(name))
+    {
+        return existing;
+    }
+    return new llvm::GlobalVariable(
+        target_, variable->getValueType(), variable->isConstant(), llvm::GlobalValue::ExternalLinkage, nullptr, name
+    );
+}
+
+}  // namespace l0::detail
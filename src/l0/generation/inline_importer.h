@@ -0,0 +1,33 @@
+#ifndef L0_GENERATION_INLINE_IMPORTER_H
+#define L0_GENERATION_INLINE_IMPORTER_H
+
+#include <llvm/IR/Constant.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/GlobalValue.h>
+#include <llvm/IR/Module.h>
+
+namespace l0::detail
+{
+
+/// @brief Copies the bodies of `inline` functions of one module into another module that calls them.
+///
+/// The copies get `available_externally` linkage, so they can be inlined by the optimizer of the importing module but
+/// are never emitted there. Functions referring to globals that are private to the defining module are not imported.
+class InlineImporter
+{
+   public:
+    InlineImporter(llvm::Module& target, const llvm::Module& source);
+    void Run();
+
+   private:
+    llvm::Module& target_;
+    const llvm::Module& source_;
+
+    bool Import(const llvm::Function& source_function, llvm::Function& target_function);
+    bool IsImportable(const llvm::GlobalValue& global) const;
+    llvm::Constant* GetOrDeclare(const llvm::GlobalValue& global);
+};
+
+}  // namespace l0::detail
+
+#endif
@@ -1,61 +1,149 @@
 #include "l0/generation/type_converter.h"
 
+#include <cstdint>
+
 #include "l0/common/constants.h"
 
 namespace l0
 {
 
-TypeConverter::TypeConverter(llvm::LLVMContext& context)
-    : context_{context}
+constexpr std::uint64_t kMaxSmallAggregateSize{16};
+
+TypeConverter::TypeConverter(llvm::LLVMContext& context, const llvm::DataLayout& data_layout)
+    : context_{context},
+      data_layout_{data_layout}
 {
-    llvm::StructType::create(context_, {}, Typename::Unit, true);
+    closure_type_ = llvm::StructType::getTypeByName(context_, "__closure");
+    unit_type_ = llvm::StructType::getTypeByName(context_, Typename::Unit);
+    if (!unit_type_)
+    {
+        unit_type_ = llvm::StructType::create(context_, {}, Typename::Unit, true);
+    }
+    pointer_type_ = llvm::PointerType::get(context_, 0);
+    slice_type_ = llvm::StructType::getTypeByName(context_, "__slice");
+    if (!slice_type_)
+    {
+        slice_type_ = llvm::StructType::create(
+            context_, {pointer_type_, llvm::IntegerType::getInt64Ty(context_)}, "__slice"
+        );
+    }
 }
 
 llvm::Type* TypeConverter::Convert(const Type& type)
 {
+    if (auto cached = converted_types_.find(&type); cached != converted_types_.end())
+    {
+        return cached->second;
+    }
+
     type.Accept(*this);
+    converted_types_.emplace(&type, result_);
     return result_;
 }
 
 llvm::FunctionType* TypeConverter::Convert(const FunctionType& type)
 {
-    type.Accept(*this);
-    return llvm::dyn_cast<llvm::FunctionType>(result_);
+    return llvm::dyn_cast<llvm::FunctionType>(Convert(static_cast<const Type&>(type)));
 }
 
 llvm::FunctionType* TypeConverter::GetFunctionDeclarationType(const FunctionType& type)
 {
-    std::vector<llvm::Type*> params;
-    for (const auto& param : *type.parameters)
+    if (auto cached = function_declaration_types_.find(&type); cached != function_declaration_types_.end())
     {
-        params.push_back(GetValueDeclarationType(*param));
+        return cached->second;
     }
-    params.push_back(llvm::PointerType::get(context_, 0));
-    llvm::Type* return_type = GetValueDeclarationType(*type.return_type);
-    return llvm::FunctionType::get(return_type, params, false);
+
+    auto function_type = CreateFunctionDeclarationType(type, true);
+    function_declaration_types_.emplace(&type, function_type);
+    return function_type;
+}
+
+llvm::FunctionType* TypeConverter::GetDirectFunctionDeclarationType(const FunctionType& type)
+{
+    if (auto cached = direct_function_declaration_types_.find(&type);
+        cached != direct_function_declaration_types_.end())
+    {
+        return cached->second;
+    }
+
+    auto function_type = CreateFunctionDeclarationType(type, false);
+    direct_function_declaration_types_.emplace(&type, function_type);
+    return function_type;
 }
 
 llvm::Type* TypeConverter::GetValueDeclarationType(const Type& type)
 {
-    if (dynamic_cast<const FunctionType*>(&type))
+    if (auto cached = value_declaration_types_.find(&type); cached != value_declaration_types_.end())
+    {
+        return cached->second;
+    }
+
+    llvm::Type* value_type = dynamic_cast<const FunctionType*>(&type) ? closure_type_ : Convert(type);
+    value_declaration_types_.emplace(&type, value_type);
+    return value_type;
+}
+
+bool TypeConverter::IsLargeAggregate(const Type& type)
+{
+    llvm::Type* llvm_type = GetValueDeclarationType(type);
+    return (llvm_type->isStructTy() || llvm_type->isArrayTy()) && llvm_type->isSized()
+        && data_layout_.getTypeAllocSize(llvm_type) > kMaxSmallAggregateSize;
+}
+
+llvm::StructType* TypeConverter::DeclareStructType(const Identifier& identifier)
+{
+    auto llvm_struct_type = llvm::StructType::create(context_, identifier.ToString());
+    struct_types_[identifier] = llvm_struct_type;
+    return llvm_struct_type;
+}
+
+llvm::StructType* TypeConverter::GetClosureType() const
+{
+    return closure_type_;
+}
+
+llvm::StructType* TypeConverter::GetUnitType() const
+{
+    return unit_type_;
+}
+
+llvm::StructType* TypeConverter::GetSliceType() const
+{
+    return slice_type_;
+}
+
+llvm::FunctionType* TypeConverter::CreateFunctionDeclarationType(const FunctionType& type, bool with_context)
+{
+    const bool returns_large_aggregate = IsLargeAggregate(*type.return_type);
+
+    std::vector<llvm::Type*> params;
+    params.reserve(type.parameters->size() + 2);
+    if (returns_large_aggregate)
+    {
+        params.push_back(pointer_type_);
+    }
+    for (const auto& param : *type.parameters)
     {
-        return llvm::StructType::getTypeByName(context_, "__closure");
+        params.push_back(IsLargeAggregate(*param) ? pointer_type_ : GetValueDeclarationType(*param));
     }
-    else
+    if (with_context)
     {
-        return Convert(type);
+        params.push_back(pointer_type_);
     }
+    llvm::Type* return_type =
+        returns_large_aggregate ? llvm::Type::getVoidTy(context_) : GetValueDeclarationType(*type.return_type);
+
+    return llvm::FunctionType::get(return_type, params, false);
 }
 
-void TypeConverter::Visit(const ReferenceType& reference_type)
+void TypeConverter::Visit(const ReferenceType&)
 {
-    reference_type.base_type->Accept(*this);
-    result_ = llvm::PointerType::get(result_, 0);
+    result_ = pointer_type_;
 }
 
 void TypeConverter::Visit(const UnitType&)
 {
-    result_ = llvm::StructType::getTypeByName(context_, Typename::Unit);
+    result_ = unit_type_;
 }
 
 void TypeConverter::Visit(const BooleanType&)
@@ -63,9 +151,14 @@ void TypeConverter::Visit(const BooleanType&)
     result_ = llvm::IntegerType::getInt1Ty(context_);
 }
 
-void TypeConverter::Visit(const IntegerType&)
+void TypeConverter::Visit(const IntegerType& integer_type)
+{
+    result_ = llvm::IntegerType::get(context_, integer_type.width);
+}
+
+void TypeConverter::Visit(const FloatType& float_type)
 {
-    result_ = llvm::IntegerType::getInt64Ty(context_);
+    result_ = (float_type.width == 32) ? llvm::Type::getFloatTy(context_) : llvm::Type::getDoubleTy(context_);
 }
 
 void TypeConverter::Visit(const CharacterType&)
@@ -73,30 +166,47 @@ void TypeConverter::Visit(const CharacterType&)
     result_ = llvm::IntegerType::getInt8Ty(context_);
 }
 
+void TypeConverter::Visit(const ArrayType& array_type)
+{
+    auto element_type = GetValueDeclarationType(*array_type.element_type);
+    result_ = llvm::ArrayType::get(element_type, array_type.length);
+}
+
+void TypeConverter::Visit(const SliceType&)
+{
+    result_ = slice_type_;
+}
+
+void TypeConverter::Visit(const VectorType& vector_type)
+{
+    result_ = llvm::FixedVectorType::get(Convert(*vector_type.element_type), vector_type.lanes);
+}
+
 void TypeConverter::Visit(const FunctionType& function_type)
 {
     std::vector<llvm::Type*> params;
+    params.reserve(function_type.parameters->size());
     for (const auto& param : *function_type.parameters)
     {
-        param->Accept(*this);
-        params.push_back(result_);
+        params.push_back(Convert(*param));
     }
 
-    function_type.return_type->Accept(*this);
-    auto return_type = result_;
+    auto return_type = Convert(*function_type.return_type);
 
     result_ = llvm::FunctionType::get(return_type, params, false);
 }
 
 void TypeConverter::Visit(const StructType& struct_type)
 {
-    auto llvm_struct_type = llvm::StructType::getTypeByName(context_, struct_type.identifier.ToString());
-    result_ = llvm_struct_type;
+    auto declared_type = struct_types_.find(struct_type.identifier);
+    result_ = (declared_type != struct_types_.end())
+                ? declared_type->second
+                : llvm::StructType::getTypeByName(context_, struct_type.identifier.ToString());
 }
 
-void TypeConverter::Visit(const EnumType&)
+void TypeConverter::Visit(const EnumType& enum_type)
 {
-    result_ = llvm::IntegerType::getInt64Ty(context_);
+    result_ = llvm::IntegerType::get(context_, enum_type.GetStorageWidth());
 }
 
 }  // namespace l0
@@ -1,37 +1,72 @@
 #ifndef L0_GENERATION_TYPE_CONVERTER
 #define L0_GENERATION_TYPE_CONVERTER
 
+#include <llvm/IR/DataLayout.h>
 #include <llvm/IR/DerivedTypes.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Type.h>
 
+#include <unordered_map>
+
+#include "l0/ast/identifier.h"
 #include "l0/types/types.h"
 
 namespace l0
 {
 
+// Conversions are memoized by the identity of the converted type object, so a converter must not outlive the AST
+// whose types it converts.
 class TypeConverter : private IConstTypeVisitor
 {
    public:
-    TypeConverter(llvm::LLVMContext& context);
+    TypeConverter(llvm::LLVMContext& context, const llvm::DataLayout& data_layout);
 
     llvm::Type* Convert(const Type& type);
     llvm::FunctionType* Convert(const FunctionType& type);
     llvm::FunctionType* GetFunctionDeclarationType(const FunctionType& type);
+    llvm::FunctionType* GetDirectFunctionDeclarationType(const FunctionType& type);
     llvm::Type* GetValueDeclarationType(const Type& type);
 
+    // Structs and arrays that do not fit into two registers are passed to functions as pointers to copies owned by the
+    // call, returned through a pointer to the caller's memory (sret) and copied with memcpy
+    bool IsLargeAggregate(const Type& type);
+
+    llvm::StructType* DeclareStructType(const Identifier& identifier);
+    llvm::StructType* GetClosureType() const;
+    llvm::StructType* GetUnitType() const;
+    llvm::StructType* GetSliceType() const;
+
    private:
     void Visit(const ReferenceType& reference_type) override;
     void Visit(const UnitType& unit_type) override;
     void Visit(const BooleanType& boolean_type) override;
     void Visit(const IntegerType& integer_type) override;
+    void Visit(const FloatType& float_type) override;
     void Visit(const CharacterType& character_type) override;
+    void Visit(const ArrayType& array_type) override;
+    void Visit(const SliceType& slice_type) override;
+    void Visit(const VectorType& vector_type) override;
     void Visit(const FunctionType& function_type) override;
     void Visit(const StructType& struct_type) override;
     void Visit(const EnumType& enum_type) override;
 
     llvm::LLVMContext& context_;
+    const llvm::DataLayout& data_layout_;
     llvm::Type* result_;
+
+    llvm::StructType* closure_type_;
+    llvm::StructType* unit_type_;
+    llvm::StructType* slice_type_;
+    llvm::PointerType* pointer_type_;
+
+    std::unordered_map<Identifier, llvm::StructType*> struct_types_;
+
+    std::unordered_map<const Type*, llvm::Type*> converted_types_;
+    std::unordered_map<const Type*, llvm::Type*> value_declaration_types_;
+    std::unordered_map<const FunctionType*, llvm::FunctionType*> function_declaration_types_;
+    std::unordered_map<const FunctionType*, llvm::FunctionType*> direct_function_declaration_types_;
+
+    llvm::FunctionType* CreateFunctionDeclarationType(const FunctionType& type, bool with_context);
 };
 
 }  // namespace l0
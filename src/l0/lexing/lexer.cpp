@@ -47,7 +47,9 @@ static const std::unordered_map<char, TokenType> SINGLE_CHARACTER_TOKENS{
     {'=', TokenType::Equals},
     {'$', TokenType::Dollar},
     {'&', TokenType::Ampersand},
+    {'|', TokenType::Pipe},
     {'^', TokenType::Caret},
+    {'~', TokenType::Tilde},
     {'<', TokenType::Less},
     {'>', TokenType::Greater},
 };
@@ -61,26 +63,44 @@ static const std::unordered_map<std::string, TokenType> TWO_CHARACTER_TOKENS{
     {":=", TokenType::ColonEquals},
     {"<=", TokenType::LessEquals},
     {">=", TokenType::GreaterEquals},
+    {"<<", TokenType::LessLess},
+    {">>", TokenType::GreaterGreater},
     {"::", TokenType::ColonColon},
+    {"..", TokenType::DotDot},
 };
 
 static const std::unordered_set<std::string_view> KEYWORDS{
+    Keyword::As,
+    Keyword::Case,
+    Keyword::Cold,
     Keyword::Constant,
     Keyword::Delete,
     Keyword::Else,
     Keyword::Enumeration,
     Keyword::False,
+    Keyword::FastMath,
+    Keyword::For,
     Keyword::Function,
+    Keyword::Hot,
     Keyword::If,
+    Keyword::In,
+    Keyword::Inline,
+    Keyword::Match,
     Keyword::Method,
     Keyword::Mutable,
     Keyword::Namespace,
     Keyword::New,
+    Keyword::NoInline,
+    Keyword::Packed,
     Keyword::Return,
     Keyword::Structure,
+    Keyword::Tail,
     Keyword::True,
     Keyword::Type,
+    Keyword::Uninitialized,
     Keyword::UnitLiteral,
+    Keyword::Unroll,
+    Keyword::Vectorize,
     Keyword::While,
 };
 
@@ -200,7 +220,7 @@ Token Lexer::Next()
 
     if (std::isdigit(current_))
     {
-        return ReadIntegerLiteral();
+        return ReadNumericLiteral();
     }
 
     if (current_ == '"')
@@ -239,7 +259,7 @@ Token Lexer::ReadIdentifierOrKeyword()
     };
 }
 
-Token Lexer::ReadIntegerLiteral()
+Token Lexer::ReadNumericLiteral()
 {
     std::string number{};
     while (std::isdigit(current_))
@@ -247,11 +267,51 @@ Token Lexer::ReadIntegerLiteral()
         number.append(std::string{current_});
         Read();
     }
+
+    // a dot that is not followed by a digit is not part of the literal, e.g. in the range '0..10'
+    if (current_ != '.' || !std::isdigit(input_.peek()))
+    {
+        Skip();
+        return Token{
+            .type = TokenType::IntegerLiteral,
+            .lexeme = number,
+            .data = std::stol(number),
+        };
+    }
+
+    number.append(std::string{current_});
+    Read();
+    while (std::isdigit(current_))
+    {
+        number.append(std::string{current_});
+        Read();
+    }
+
+    if (current_ == 'e' || current_ == 'E')
+    {
+        number.append(std::string{current_});
+        Read();
+        if (current_ == '+' || current_ == '-')
+        {
+            number.append(std::string{current_});
+            Read();
+        }
+        if (!std::isdigit(current_))
+        {
+            throw LexerError(std::format("Missing exponent in floating-point literal '{}'.", number));
+        }
+        while (std::isdigit(current_))
+        {
+            number.append(std::string{current_});
+            Read();
+        }
+    }
+
     Skip();
     return Token{
-        .type = TokenType::IntegerLiteral,
+        .type = TokenType::FloatLiteral,
         .lexeme = number,
-        .data = std::stol(number),
+        .data = std::stod(number),
     };
 }
 
@@ -40,7 +40,7 @@ class Lexer
     char ReadAndSkip();
 
     Token ReadIdentifierOrKeyword();
-    Token ReadIntegerLiteral();
+    Token ReadNumericLiteral();
     Token ReadCharacterLiteral();
     Token ReadStringLiteral();
 
@@ -19,6 +19,8 @@ std::string str(TokenType type)
             return "Identifier";
         case TokenType::IntegerLiteral:
             return "IntegerLiteral";
+        case TokenType::FloatLiteral:
+            return "FloatLiteral";
         case TokenType::CharacterLiteral:
             return "CharacterLiteral";
         case TokenType::StringLiteral:
@@ -37,8 +39,12 @@ std::string str(TokenType type)
             return "Bang";
         case TokenType::Ampersand:
             return "Ampersand";
+        case TokenType::Pipe:
+            return "Pipe";
         case TokenType::Caret:
             return "Caret";
+        case TokenType::Tilde:
+            return "Tilde";
         case TokenType::EqualsEquals:
             return "EqualsEquals";
         case TokenType::BangEquals:
@@ -55,6 +61,10 @@ std::string str(TokenType type)
             return "LessEquals";
         case TokenType::GreaterEquals:
             return "GreaterEquals";
+        case TokenType::LessLess:
+            return "LessLess";
+        case TokenType::GreaterGreater:
+            return "GreaterGreater";
         case TokenType::OpeningParen:
             return "OpeningParen";
         case TokenType::ClosingParen:
@@ -85,6 +95,8 @@ std::string str(TokenType type)
             return "ColonEquals";
         case l0::TokenType::ColonColon:
             return "ColonColon";
+        case l0::TokenType::DotDot:
+            return "DotDot";
     }
     std::unreachable();
 }
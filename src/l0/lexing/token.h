@@ -18,6 +18,7 @@ enum class TokenType
     Identifier,
 
     IntegerLiteral,
+    FloatLiteral,
     CharacterLiteral,
     StringLiteral,
 
@@ -28,7 +29,9 @@ enum class TokenType
     Percent,
     Bang,
     Ampersand,
+    Pipe,
     Caret,
+    Tilde,
     EqualsEquals,
     BangEquals,
     AmpersandAmpersand,
@@ -37,6 +40,8 @@ enum class TokenType
     Greater,
     LessEquals,
     GreaterEquals,
+    LessLess,
+    GreaterGreater,
 
     OpeningParen,
     ClosingParen,
@@ -53,6 +58,7 @@ enum class TokenType
     Dollar,
     ColonEquals,
     ColonColon,
+    DotDot,
 };
 
 std::string str(TokenType type);
@@ -1,7 +1,11 @@
 #include "l0/main/compiler_driver.h"
 
+#include <algorithm>
+#include <array>
+#include <format>
 #include <fstream>
 #include <print>
+#include <ranges>
 
 #include "l0/common/constants.h"
 #include "l0/generation/generation.h"
@@ -15,6 +19,47 @@
 namespace l0
 {
 
+namespace
+{
+
+// Struct types are equal if their identifiers are, so structs of the same name declared by different modules are
+// compared by their members instead.
+bool HaveSameLayout(const Type& first, const Type& second)
+{
+    auto first_struct = dynamic_cast<const StructType*>(&first);
+    auto second_struct = dynamic_cast<const StructType*>(&second);
+    if (first_struct && second_struct)
+    {
+        return first_struct->identifier == second_struct->identifier
+            && std::ranges::equal(
+                   *first_struct->members,
+                   *second_struct->members,
+                   [](const auto& lhs, const auto& rhs)
+                   {
+                       return lhs->name == rhs->name && lhs->is_static == rhs->is_static
+                           && HaveSameLayout(*lhs->type, *rhs->type);
+                   }
+            );
+    }
+
+    auto first_array = dynamic_cast<const ArrayType*>(&first);
+    auto second_array = dynamic_cast<const ArrayType*>(&second);
+    if (first_array && second_array)
+    {
+        return first_array->length == second_array->length
+            && HaveSameLayout(*first_array->element_type, *second_array->element_type);
+    }
+
+    return first == second;
+}
+
+}  // namespace
+
+CompilerDriver::CompilerDriver(CompilerOptions options)
+    : options_{options}
+{
+}
+
 void CompilerDriver::LoadModules(const std::vector<std::filesystem::path>& paths)
 {
     std::println("Loading {} module(s)", paths.size());
@@ -64,6 +109,7 @@ void CompilerDriver::DeclareExternalTypes()
             if (other_module->name != module->name)
             {
                 module->externals->UpdateTypes(*other_module->globals);
+                module->generics.insert(other_module->generics.begin(), other_module->generics.end());
             }
         }
     }
@@ -92,6 +138,21 @@ void CompilerDriver::FillGlobalTypes()
     }
 }
 
+void CompilerDriver::LayoutGlobalTypes()
+{
+    if (!options_.reorder_struct_members)
+    {
+        return;
+    }
+
+    std::println("Reordering struct members");
+    for (const auto& module : modules_)
+    {
+        std::println("\tFor module '{}'", module->name);
+        l0::ReorderStructMembers(*module);
+    }
+}
+
 void CompilerDriver::DeclareGlobalVariables()
 {
     std::println("Declaring global variables");
@@ -121,13 +182,23 @@ void CompilerDriver::DeclareExternalVariables()
     for (const auto& module : modules_)
     {
         std::println("\tFor module '{}'", module->name);
-        for (const auto& other_module : modules_)
+        try
         {
-            if (other_module->name != module->name)
+            for (const auto& other_module : modules_)
             {
-                module->externals->UpdateVariables(*other_module->globals);
+                if (other_module->name != module->name)
+                {
+                    DeclareExternalInstances(*module, *other_module);
+                    module->externals->UpdateVariables(*other_module->globals);
+                    DeclareInlineExternals(*module, *other_module);
+                }
             }
         }
+        catch (const ScopeError& err)
+        {
+            std::println("Scope error occured: {}", err.GetMessage());
+            exit(-1);
+        }
     }
 }
 
@@ -145,7 +216,7 @@ void CompilerDriver::GenerateIR()
 {
     auto pointer_type_ = llvm::PointerType::get(context_, 0);
     auto closure_type_ = llvm::StructType::create(context_, "__closure");
-    closure_type_->setBody({pointer_type_, pointer_type_}, true);
+    closure_type_->setBody({pointer_type_, pointer_type_});
 
     std::println("Semantic analysis");
     for (const auto& module : modules_)
@@ -155,6 +226,22 @@ void CompilerDriver::GenerateIR()
     }
 }
 
+void CompilerDriver::ImportInlineFunctions()
+{
+    std::println("Importing inline functions");
+    for (const auto& module : modules_)
+    {
+        std::println("\tFor module '{}'", module->name);
+        for (const auto& other_module : modules_)
+        {
+            if (other_module->name != module->name)
+            {
+                l0::ImportInlineFunctions(*module, *other_module);
+            }
+        }
+    }
+}
+
 void CompilerDriver::StoreIR()
 {
     std::println("Saving IR to filesystem");
@@ -199,6 +286,50 @@ void CompilerDriver::LoadModule(const std::filesystem::path& input_path)
     modules_.push_back(module);
 }
 
+namespace
+{
+
+struct SizedIntegerType
+{
+    std::string_view name;
+    unsigned width;
+    bool is_signed;
+};
+
+constexpr std::array<SizedIntegerType, 7> kSizedIntegerTypes{{
+    {Typename::Integer8, 8, true},
+    {Typename::Integer16, 16, true},
+    {Typename::Integer32, 32, true},
+    {Typename::UnsignedInteger8, 8, false},
+    {Typename::UnsignedInteger16, 16, false},
+    {Typename::UnsignedInteger32, 32, false},
+    {Typename::UnsignedInteger64, 64, false},
+}};
+
+struct VectorElementType
+{
+    std::string_view name;
+    unsigned width;
+};
+
+constexpr std::array<VectorElementType, 11> kVectorElementTypes{{
+    {Typename::Integer8, 8},
+    {Typename::Integer16, 16},
+    {Typename::Integer32, 32},
+    {Typename::Integer, 64},
+    {Typename::UnsignedInteger8, 8},
+    {Typename::UnsignedInteger16, 16},
+    {Typename::UnsignedInteger32, 32},
+    {Typename::UnsignedInteger64, 64},
+    {Typename::Float32, 32},
+    {Typename::Float64, 64},
+    {Typename::Character, 8},
+}};
+
+constexpr std::array<unsigned, 2> kVectorWidths{128, 256};
+
+}  // namespace
+
 void CompilerDriver::FillEnvironmentScope(Module& module)
 {
     module.environment->DeclareType(Typename::Unit);
@@ -211,11 +342,44 @@ void CompilerDriver::FillEnvironmentScope(Module& module)
     module.environment->DefineType(Typename::Boolean, std::make_shared<BooleanType>(TypeQualifier::Constant));
     auto i64 = std::make_shared<IntegerType>(TypeQualifier::Constant);
     module.environment->DefineType(Typename::Integer, i64);
+    for (auto [name, width, is_signed] : kSizedIntegerTypes)
+    {
+        module.environment->DeclareType(name);
+        module.environment->DefineType(name, std::make_shared<IntegerType>(TypeQualifier::Constant, width, is_signed));
+    }
+    module.environment->DeclareType(Typename::Float32);
+    module.environment->DefineType(Typename::Float32, std::make_shared<FloatType>(TypeQualifier::Constant, 32));
+    module.environment->DeclareType(Typename::Float64);
+    module.environment->DefineType(Typename::Float64, std::make_shared<FloatType>(TypeQualifier::Constant, 64));
     auto c8 = std::make_shared<CharacterType>(TypeQualifier::Constant);
     module.environment->DefineType(Typename::Character, c8);
     auto cstring = std::make_shared<ReferenceType>(c8, TypeQualifier::Constant);
     module.environment->DefineType(Typename::CString, cstring);
 
+    // vectors fill 128 or 256 bits with lanes of a numeric or character type, e.g. V4I32, V8I16 or V16C8; comparing
+    // them yields masks with as many lanes, e.g. V16Boolean
+    auto boolean = module.environment->GetTypeDefinition(Typename::Boolean);
+    for (auto [element_name, element_width] : kVectorElementTypes)
+    {
+        auto element_type = module.environment->GetTypeDefinition(element_name);
+        for (auto width : kVectorWidths)
+        {
+            auto lanes = width / element_width;
+            auto name = std::format("V{}{}", lanes, element_name);
+            module.environment->DeclareType(name);
+            auto vector_type = std::make_shared<VectorType>(element_type, lanes, TypeQualifier::Constant);
+            module.environment->DefineType(name, vector_type);
+
+            auto mask_name = std::format("V{}{}", lanes, Typename::Boolean);
+            if (!module.environment->IsTypeDeclared(mask_name))
+            {
+                module.environment->DeclareType(mask_name);
+                auto mask_type = std::make_shared<VectorType>(boolean, lanes, TypeQualifier::Constant);
+                module.environment->DefineType(mask_name, mask_type);
+            }
+        }
+    }
+
     auto parameters_string = std::make_shared<ParameterList>(std::initializer_list<std::shared_ptr<Type>>{cstring});
     auto string_to_int = std::make_shared<FunctionType>(parameters_string, i64, TypeQualifier::Constant);
     module.environment->DeclareVariable("printf", string_to_int);
@@ -224,6 +388,68 @@ void CompilerDriver::FillEnvironmentScope(Module& module)
     module.environment->DeclareVariable("getchar", void_to_char);
 }
 
+void CompilerDriver::DeclareExternalInstances(Module& module, const Module& other_module)
+{
+    // Instances of generic structs may have been created while declaring the globals. Every module using an instance
+    // creates its own, so the same instance can be exported by several modules. Since instances are named after their
+    // type arguments only, an instance known already must have the same layout; everything else is a conflict.
+    for (const auto& identifier : other_module.generic_instances | std::views::keys)
+    {
+        if (!other_module.globals->IsTypeDeclared(identifier))
+        {
+            continue;
+        }
+
+        auto type = other_module.globals->GetTypeDefinition(identifier);
+        for (const auto& scope : {module.globals, module.externals})
+        {
+            if (scope->IsTypeDeclared(identifier) && !HaveSameLayout(*scope->GetTypeDefinition(identifier), *type))
+            {
+                throw ScopeError(
+                    std::format("Conflicting definitions of generic instance '{}'.", identifier.ToString())
+                );
+            }
+        }
+        if (!module.externals->IsTypeDeclared(identifier))
+        {
+            module.externals->DeclareType(identifier);
+            module.externals->DefineType(identifier, type);
+        }
+    }
+}
+
+void CompilerDriver::DeclareInlineExternals(Module& module, const Module& other_module)
+{
+    auto add_if_inline = [&module](const Identifier& identifier, std::shared_ptr<Expression> initializer)
+    {
+        auto function = dynamic_pointer_cast<Function>(initializer);
+        if (function && function->inlining == Function::Inlining::Always)
+        {
+            module.inline_externals[identifier] = function;
+        }
+    };
+
+    for (const auto& declaration : other_module.global_declarations)
+    {
+        add_if_inline(declaration->identifier, declaration->initializer);
+    }
+    for (const auto& type_declaration : other_module.global_type_declarations)
+    {
+        auto struct_type = dynamic_pointer_cast<StructType>(type_declaration->type);
+        if (!struct_type)
+        {
+            continue;
+        }
+        for (const auto& member : *struct_type->members)
+        {
+            if (member->default_initializer_global_name)
+            {
+                add_if_inline(*member->default_initializer_global_name, member->default_initializer);
+            }
+        }
+    }
+}
+
 void CompilerDriver::SemanticCheckModule(Module& module)
 {
     std::println("\t\tResolving variables");
@@ -269,13 +495,64 @@ void CompilerDriver::SemanticCheckModule(Module& module)
         std::println("Semantic error occured: {}", err.GetMessage());
         exit(-1);
     }
+
+    std::println("\t\tEvaluating global constants");
+    try
+    {
+        EvaluateGlobalConstants(module);
+    }
+    catch (const SemanticError& err)
+    {
+        std::println("Semantic error occured: {}", err.GetMessage());
+        exit(-1);
+    }
+
+    std::println("\t\tConstant folding");
+    try
+    {
+        FoldConstants(module);
+    }
+    catch (const SemanticError& err)
+    {
+        std::println("Semantic error occured: {}", err.GetMessage());
+        exit(-1);
+    }
+
+    std::println("\t\tEscape analysis");
+    try
+    {
+        AnalyzeEscapes(module);
+    }
+    catch (const SemanticError& err)
+    {
+        std::println("Semantic error occured: {}", err.GetMessage());
+        exit(-1);
+    }
+
+    std::println("\t\tBounds check elimination");
+    try
+    {
+        EliminateBoundsChecks(module);
+    }
+    catch (const SemanticError& err)
+    {
+        std::println("Semantic error occured: {}", err.GetMessage());
+        exit(-1);
+    }
 }
 
 void CompilerDriver::GenerateIRForModule(Module& module)
 {
     try
     {
-        l0::GenerateIR(module, context_);
+        l0::GenerateIR(
+            module,
+            context_,
+            {.keep_constants_in_registers = options_.keep_constants_in_registers,
+             .fast_math = options_.fast_math,
+             .bounds_checks = options_.bounds_checks,
+             .specialization_budget = options_.specialization_budget}
+        );
     }
     catch (const GeneratorError& ge)
     {
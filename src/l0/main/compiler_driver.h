@@ -4,36 +4,54 @@
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 
+#include <cstddef>
 #include <filesystem>
 #include <memory>
 #include <vector>
 
 #include "l0/ast/module.h"
+#include "l0/generation/generation.h"
 
 namespace l0
 {
 
+struct CompilerOptions
+{
+    bool reorder_struct_members{false};
+    bool keep_constants_in_registers{false};
+    bool fast_math{false};
+    bool bounds_checks{false};
+    std::size_t specialization_budget{GeneratorOptions{}.specialization_budget};
+};
+
 class CompilerDriver
 {
    public:
+    CompilerDriver(CompilerOptions options = {});
+
     void LoadModules(const std::vector<std::filesystem::path>& paths);
     void DeclareEnvironmentSymbols();
     void DeclareGlobalTypes();
     void DeclareExternalTypes();
     void FillGlobalTypes();
+    void LayoutGlobalTypes();
     void DeclareGlobalVariables();
     void DeclareExternalVariables();
     void RunSemanticAnalysis();
     void GenerateIR();
+    void ImportInlineFunctions();
     void StoreIR();
 
    private:
     void LoadModule(const std::filesystem::path& input_path);
     void FillEnvironmentScope(Module& module);
+    void DeclareExternalInstances(Module& module, const Module& other_module);
+    void DeclareInlineExternals(Module& module, const Module& other_module);
     void SemanticCheckModule(Module& module);
     void GenerateIRForModule(Module& module);
     void StoreModuleIR(Module& module);
 
+    CompilerOptions options_;
     std::vector<std::shared_ptr<Module>> modules_{};
     llvm::LLVMContext context_{};
 };
@@ -1,5 +1,8 @@
+#include <charconv>
 #include <filesystem>
 #include <print>
+#include <span>
+#include <string_view>
 
 #include "l0/main/compiler_driver.h"
 
@@ -8,19 +11,62 @@ int main(int argc, char* argv[])
     using namespace l0;
 
     std::println("Hello, World!");
-    CompilerDriver driver{};
 
-    std::vector<std::filesystem::path> input_paths{argv + 1, argv + argc};
+    CompilerOptions options{};
+    std::vector<std::filesystem::path> input_paths{};
+    for (std::string_view argument : std::span(argv + 1, argv + argc))
+    {
+        if (argument == "--reorder-struct-members")
+        {
+            options.reorder_struct_members = true;
+        }
+        else if (argument == "--keep-constants-in-registers")
+        {
+            options.keep_constants_in_registers = true;
+        }
+        else if (argument == "--fast-math")
+        {
+            options.fast_math = true;
+        }
+        else if (argument == "--bounds-checks")
+        {
+            options.bounds_checks = true;
+        }
+        else if (argument.starts_with("--specialization-budget="))
+        {
+            auto value = argument.substr(argument.find('=') + 1);
+            auto [end, error] =
+                std::from_chars(value.data(), value.data() + value.size(), options.specialization_budget);
+            if (error != std::errc{} || end != value.data() + value.size())
+            {
+                std::println("Invalid specialization budget '{}'", value);
+                return -1;
+            }
+        }
+        else if (argument.starts_with("--"))
+        {
+            std::println("Unknown option '{}'", argument);
+            return -1;
+        }
+        else
+        {
+            input_paths.emplace_back(argument);
+        }
+    }
+
+    CompilerDriver driver{options};
 
     driver.LoadModules(input_paths);
     driver.DeclareEnvironmentSymbols();
     driver.DeclareGlobalTypes();
     driver.DeclareExternalTypes();
     driver.FillGlobalTypes();
+    driver.LayoutGlobalTypes();
     driver.DeclareGlobalVariables();
     driver.DeclareExternalVariables();
     driver.RunSemanticAnalysis();
     driver.GenerateIR();
+    driver.ImportInlineFunctions();
     driver.StoreIR();
 
     std::println("Leaving");
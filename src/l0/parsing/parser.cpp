@@ -2,10 +2,13 @@
 
 #include <llvm/IR/PassManager.h>
 
+#include <array>
 #include <optional>
 #include <ranges>
+#include <sstream>
 
 #include "l0/common/constants.h"
+#include "l0/lexing/lexer.h"
 
 namespace l0
 {
@@ -28,6 +31,20 @@ std::string ParserError::GetMessage() const
 namespace detail
 {
 
+static constexpr std::array kFunctionAttributes{
+    Keyword::Constant,
+    Keyword::Inline,
+    Keyword::NoInline,
+    Keyword::Hot,
+    Keyword::Cold,
+    Keyword::FastMath,
+};
+
+static constexpr std::array kLoopAttributes{
+    Keyword::Unroll,
+    Keyword::Vectorize,
+};
+
 Parser::Parser(const std::vector<Token>& tokens)
     : tokens_{tokens}
 {
@@ -68,6 +85,26 @@ bool Parser::PeekIsKeyword(std::string_view keyword)
     return token.type == TokenType::Keyword && std::any_cast<std::string>(token.data) == keyword;
 }
 
+bool Parser::PeekIsCallableDeclaration(std::string_view keyword)
+{
+    // function attributes may precede the 'fn' or 'method' keyword
+    auto pos = pos_;
+    while (pos < tokens_.size() && tokens_.at(pos).type == TokenType::Keyword)
+    {
+        auto lexeme = std::any_cast<std::string>(tokens_.at(pos).data);
+        if (lexeme == keyword)
+        {
+            return true;
+        }
+        if (std::ranges::find(kFunctionAttributes, lexeme) == kFunctionAttributes.end())
+        {
+            return false;
+        }
+        ++pos;
+    }
+    return false;
+}
+
 Token Parser::Consume()
 {
     if (pos_ >= tokens_.size())
@@ -226,16 +263,22 @@ std::shared_ptr<StatementBlock> Parser::ParseStatementBlock(TokenType delimiter)
 
 void Parser::ParseGlobalStatement(Module& module)
 {
+    if (PeekIsGenericDeclaration())
+    {
+        ParseGenericDeclaration(module);
+        return;
+    }
+
     std::variant<std::shared_ptr<Declaration>, std::shared_ptr<TypeDeclaration>> statement;
     if (Peek().type == TokenType::Identifier && PeekNext().type == TokenType::Colon)
     {
         statement = ParseGlobalDeclaration();
     }
-    else if (PeekIsKeyword(Keyword::Function))
+    else if (PeekIsCallableDeclaration(Keyword::Function))
     {
         statement = ParseAlternativeFunctionDeclaration();
     }
-    else if (PeekIsKeyword(Keyword::Structure))
+    else if (PeekIsKeyword(Keyword::Structure) || PeekIsKeyword(Keyword::Packed))
     {
         statement = ParseAlternativeStructDeclaration();
     }
@@ -246,7 +289,7 @@ void Parser::ParseGlobalStatement(Module& module)
     else
     {
         throw ParserError(std::format(
-            "Expected identifier, or keywords 'fn', 'struct', or 'enum', got token '{}' of type '{}' instead.",
+            "Expected identifier, function attributes, or keywords 'fn', 'struct', or 'enum', got token '{}' of type '{}' instead.",
             Peek().lexeme,
             str(Peek().type)
         ));
@@ -271,6 +314,156 @@ void Parser::ParseGlobalStatement(Module& module)
     );
 }
 
+bool Parser::PeekIsGenericDeclaration()
+{
+    // a generic function or struct has a list of type parameters after its name, e.g. 'fn max<T> (...)'
+    auto pos = pos_;
+    auto is_keyword = [this, &pos](auto&& predicate)
+    {
+        return pos < tokens_.size() && tokens_.at(pos).type == TokenType::Keyword
+            && predicate(std::any_cast<std::string>(tokens_.at(pos).data));
+    };
+
+    while (is_keyword([](const std::string& keyword)
+                      { return keyword == Keyword::Packed || std::ranges::contains(kFunctionAttributes, keyword); }))
+    {
+        ++pos;
+    }
+    if (!is_keyword([](const std::string& keyword)
+                    { return keyword == Keyword::Function || keyword == Keyword::Structure; }))
+    {
+        return false;
+    }
+    ++pos;
+
+    if (pos >= tokens_.size() || tokens_.at(pos).type != TokenType::Identifier)
+    {
+        return false;
+    }
+    ++pos;
+    while (pos + 1 < tokens_.size() && tokens_.at(pos).type == TokenType::ColonColon
+           && tokens_.at(pos + 1).type == TokenType::Identifier)
+    {
+        pos += 2;
+    }
+    return pos < tokens_.size() && tokens_.at(pos).type == TokenType::Less;
+}
+
+namespace
+{
+
+// Returns the tokens spelling out the given type, as they are substituted for a type parameter
+std::vector<Token> TokenizeType(const Type& type, Token::LineType line)
+{
+    std::istringstream spelling{ModifyQualifier(type, TypeQualifier::Constant)->ToString()};
+    auto tokens = Tokenize(spelling);
+    tokens.pop_back();
+    for (auto& token : tokens)
+    {
+        token.line = line;
+    }
+    return tokens;
+}
+
+}  // namespace
+
+void Parser::ParseGenericDeclaration(Module& module)
+{
+    auto begin = pos_;
+    ParseFunctionAttributes();
+    ConsumeIfKeyword(Keyword::Packed);
+    Expect(TokenType::Keyword);
+    auto identifier = ParseIdentifier();
+    auto name = pos_ - 1;
+    auto type_parameters = ParseTypeParameterList();
+    auto body = pos_;
+
+    // the declaration ends with the brace closing the function body or the list of struct members
+    while (Peek().type != TokenType::OpeningBrace)
+    {
+        Consume();
+    }
+    std::size_t depth{0};
+    do
+    {
+        auto token = Consume();
+        if (token.type == TokenType::OpeningBrace)
+        {
+            ++depth;
+        }
+        else if (token.type == TokenType::ClosingBrace)
+        {
+            --depth;
+        }
+    } while (depth > 0);
+
+    auto generic = std::make_shared<GenericDeclaration>();
+    generic->identifier = current_namespace_ + identifier;
+    generic->type_parameters = type_parameters;
+
+    // instances are parsed from the tokens of the generic, with the name and the type parameters replaced
+    generic->instantiate = [head = std::vector<Token>(tokens_.begin() + begin, tokens_.begin() + name),
+                            name_token = tokens_.at(name),
+                            body = std::vector<Token>(tokens_.begin() + body, tokens_.begin() + pos_),
+                            end_of_file = tokens_.back(),
+                            type_parameters,
+                            namespace_ = current_namespace_](
+                               const std::string& instance_name,
+                               const std::vector<std::shared_ptr<Type>>& type_arguments
+                           ) -> GenericDeclaration::Instance
+    {
+        std::vector<Token> tokens{head};
+        auto instance_name_token = name_token;
+        instance_name_token.lexeme = instance_name;
+        instance_name_token.data = instance_name;
+        tokens.push_back(instance_name_token);
+
+        for (const auto& token : body)
+        {
+            auto parameter = token.type == TokenType::Identifier
+                               ? std::ranges::find(type_parameters, std::any_cast<std::string>(token.data))
+                               : type_parameters.end();
+            if (parameter == type_parameters.end() || type_arguments.empty())
+            {
+                tokens.push_back(token);
+                continue;
+            }
+            auto argument = type_arguments.at(std::distance(type_parameters.begin(), parameter));
+            auto argument_tokens = TokenizeType(*argument, token.line);
+            tokens.insert(tokens.end(), argument_tokens.begin(), argument_tokens.end());
+        }
+        tokens.push_back(end_of_file);
+
+        return ParseGenericInstance(tokens, namespace_);
+    };
+
+    // parsing the declaration with its type parameters in place checks its syntax and yields the annotations that
+    // type arguments are inferred from
+    generic->definition = generic->instantiate(identifier.GetLast(), {});
+
+    if (module.generics.contains(generic->identifier))
+    {
+        throw ParserError(std::format("Duplicate declaration of generic '{}'.", generic->identifier.ToString()));
+    }
+    module.generics[generic->identifier] = generic;
+}
+
+GenericDeclaration::Instance Parser::ParseGenericInstance(const std::vector<Token>& tokens, Identifier namespace_)
+{
+    Parser parser{tokens};
+    parser.current_namespace_ = namespace_;
+
+    Module module{};
+    parser.ParseGlobalStatement(module);
+    parser.Expect(TokenType::EndOfFile);
+
+    if (!module.global_declarations.empty())
+    {
+        return module.global_declarations.front();
+    }
+    return module.global_type_declarations.front();
+}
+
 std::shared_ptr<Statement> Parser::ParseStatement()
 {
     if (Peek().type == TokenType::Identifier && PeekNext().type == TokenType::Colon)
@@ -289,19 +482,28 @@ std::shared_ptr<Statement> Parser::ParseStatement()
     {
         return ParseConditionalStatement();
     }
+    else if (PeekIsKeyword(Keyword::Match))
+    {
+        return ParseMatchStatement();
+    }
     else if (PeekIsKeyword(Keyword::While))
     {
         return ParseWhileLoop();
     }
+    else if (PeekIsKeyword(Keyword::For)
+             || std::ranges::any_of(kLoopAttributes, [this](auto keyword) { return PeekIsKeyword(keyword); }))
+    {
+        return ParseForLoop();
+    }
     else if (PeekIsKeyword(Keyword::Delete))
     {
         return ParseDeallocation();
     }
-    else if (PeekIsKeyword(Keyword::Function))
+    else if (PeekIsCallableDeclaration(Keyword::Function))
     {
         return ParseAlternativeFunctionDeclaration();
     }
-    else if (PeekIsKeyword(Keyword::Structure))
+    else if (PeekIsKeyword(Keyword::Structure) || PeekIsKeyword(Keyword::Packed))
     {
         return ParseAlternativeStructDeclaration();
     }
@@ -309,7 +511,7 @@ std::shared_ptr<Statement> Parser::ParseStatement()
     {
         return ParseAlternativeEnumDeclaration();
     }
-    else if (PeekIsKeyword(Keyword::Method))
+    else if (PeekIsCallableDeclaration(Keyword::Method))
     {
         return ParseAlternativeMethodDeclaration();
     }
@@ -336,7 +538,7 @@ std::variant<std::shared_ptr<Declaration>, std::shared_ptr<TypeDeclaration>> Par
     if (ConsumeIfKeyword(Keyword::Type))
     {
         Expect(TokenType::Equals);
-        if (PeekIsKeyword(Keyword::Structure))
+        if (PeekIsKeyword(Keyword::Structure) || PeekIsKeyword(Keyword::Packed))
         {
             auto old_namespace = current_namespace_;
             current_namespace_ += identifier.GetPrefix();
@@ -355,7 +557,7 @@ std::variant<std::shared_ptr<Declaration>, std::shared_ptr<TypeDeclaration>> Par
         else
         {
             throw ParserError(std::format(
-                "Expected keyword 'struct' or 'enum', got token '{}' of type  '{}' instead.",
+                "Expected keyword 'struct', 'packed' or 'enum', got token '{}' of type  '{}' instead.",
                 Peek().lexeme,
                 str(Peek().type)
             ));
@@ -401,8 +603,13 @@ std::shared_ptr<Statement> Parser::ParseReturnStatement()
     }
     else
     {
+        bool is_tail_call = ConsumeIfKeyword(Keyword::Tail);
         auto return_value = ParseExpression();
-        return std::make_shared<ReturnStatement>(return_value);
+        if (is_tail_call && !dynamic_pointer_cast<Call>(return_value))
+        {
+            throw ParserError("Expected a function call after 'return tail'.");
+        }
+        return std::make_shared<ReturnStatement>(return_value, is_tail_call);
     }
 }
 
@@ -442,6 +649,64 @@ std::shared_ptr<Statement> Parser::ParseConditionalStatement()
     }
 }
 
+std::shared_ptr<Statement> Parser::ParseMatchStatement()
+{
+    ExpectKeyword(Keyword::Match);
+    auto subject = ParseExpression();
+    Expect(TokenType::Colon);
+    Expect(TokenType::OpeningBrace);
+
+    auto cases = std::make_shared<MatchCaseList>();
+    std::shared_ptr<StatementBlock> else_block{nullptr};
+    while (ConsumeAll(TokenType::Semicolon).type != TokenType::ClosingBrace)
+    {
+        if (else_block)
+        {
+            throw ParserError("The 'else' case must be the last case of a match statement.");
+        }
+
+        if (ConsumeIfKeyword(Keyword::Else))
+        {
+            Expect(TokenType::Colon);
+            Expect(TokenType::OpeningBrace);
+            else_block = ParseStatementBlock(TokenType::ClosingBrace);
+            Expect(TokenType::ClosingBrace);
+        }
+        else
+        {
+            cases->push_back(ParseMatchCase());
+        }
+        Expect(TokenType::Semicolon);
+    }
+    Expect(TokenType::ClosingBrace);
+
+    return std::make_shared<MatchStatement>(subject, cases, else_block);
+}
+
+std::shared_ptr<MatchCase> Parser::ParseMatchCase()
+{
+    ExpectKeyword(Keyword::Case);
+
+    auto patterns = std::make_shared<MatchPatternList>();
+    do
+    {
+        auto pattern = std::make_shared<MatchPattern>();
+        pattern->value = ParseExpression();
+        if (ConsumeIf(TokenType::DotDot))
+        {
+            pattern->end = ParseExpression();
+        }
+        patterns->push_back(pattern);
+    } while (ConsumeIf(TokenType::Comma));
+
+    Expect(TokenType::Colon);
+    Expect(TokenType::OpeningBrace);
+    auto body = ParseStatementBlock(TokenType::ClosingBrace);
+    Expect(TokenType::ClosingBrace);
+
+    return std::make_shared<MatchCase>(MatchCase{.patterns = patterns, .body = body});
+}
+
 std::shared_ptr<Statement> Parser::ParseWhileLoop()
 {
     ExpectKeyword(Keyword::While);
@@ -453,6 +718,44 @@ std::shared_ptr<Statement> Parser::ParseWhileLoop()
     return std::make_shared<WhileLoop>(condition, body);
 }
 
+std::shared_ptr<Statement> Parser::ParseForLoop()
+{
+    bool unroll{false};
+    bool vectorize{false};
+    while (true)
+    {
+        auto attribute = std::ranges::find_if(kLoopAttributes, [this](auto keyword) { return PeekIsKeyword(keyword); });
+        if (attribute == kLoopAttributes.end())
+        {
+            break;
+        }
+        Consume();
+
+        bool& is_set = (*attribute == Keyword::Unroll) ? unroll : vectorize;
+        if (is_set)
+        {
+            throw ParserError(std::format("Loop attribute '{}' is given more than once.", *attribute));
+        }
+        is_set = true;
+    }
+
+    ExpectKeyword(Keyword::For);
+    Token variable = Expect(TokenType::Identifier);
+    ExpectKeyword(Keyword::In);
+    auto begin = ParseExpression();
+    Expect(TokenType::DotDot);
+    auto end = ParseExpression();
+    Expect(TokenType::Colon);
+    Expect(TokenType::OpeningBrace);
+    auto body = ParseStatementBlock(TokenType::ClosingBrace);
+    Expect(TokenType::ClosingBrace);
+
+    auto for_loop = std::make_shared<ForLoop>(std::any_cast<std::string>(variable.data), begin, end, body);
+    for_loop->unroll = unroll;
+    for_loop->vectorize = vectorize;
+    return for_loop;
+}
+
 std::shared_ptr<Statement> Parser::ParseDeallocation()
 {
     ExpectKeyword(Keyword::Delete);
@@ -511,7 +814,7 @@ std::shared_ptr<Expression> Parser::ParseEquality()
 
 std::shared_ptr<Expression> Parser::ParseComparison()
 {
-    auto expression = ParseSum();
+    auto expression = ParseBitwiseOr();
     std::optional<Token> token;
     while ((token = ConsumeIf({TokenType::Less, TokenType::Greater, TokenType::LessEquals, TokenType::GreaterEquals})))
     {
@@ -543,6 +846,51 @@ std::shared_ptr<Expression> Parser::ParseComparison()
                 throw ParserError("ParseComparison()");
             }
         }
+        expression = std::make_shared<BinaryOp>(expression, ParseBitwiseOr(), op);
+    }
+    return expression;
+}
+
+std::shared_ptr<Expression> Parser::ParseBitwiseOr()
+{
+    // unlike in C, bitwise operators bind tighter than comparisons, so that 'flags & mask == 0' needs no parentheses
+    auto expression = ParseBitwiseXor();
+    while (ConsumeIf(TokenType::Pipe))
+    {
+        expression = std::make_shared<BinaryOp>(expression, ParseBitwiseXor(), BinaryOp::Operator::Pipe);
+    }
+    return expression;
+}
+
+std::shared_ptr<Expression> Parser::ParseBitwiseXor()
+{
+    auto expression = ParseBitwiseAnd();
+    while (ConsumeIf(TokenType::Tilde))
+    {
+        expression = std::make_shared<BinaryOp>(expression, ParseBitwiseAnd(), BinaryOp::Operator::Tilde);
+    }
+    return expression;
+}
+
+std::shared_ptr<Expression> Parser::ParseBitwiseAnd()
+{
+    // a binary '&' follows an operand, whereas the address-of operator starts one
+    auto expression = ParseShift();
+    while (ConsumeIf(TokenType::Ampersand))
+    {
+        expression = std::make_shared<BinaryOp>(expression, ParseShift(), BinaryOp::Operator::Ampersand);
+    }
+    return expression;
+}
+
+std::shared_ptr<Expression> Parser::ParseShift()
+{
+    auto expression = ParseSum();
+    std::optional<Token> token;
+    while ((token = ConsumeIf({TokenType::LessLess, TokenType::GreaterGreater})))
+    {
+        BinaryOp::Operator op = (token.value().type == TokenType::LessLess) ? BinaryOp::Operator::LessLess
+                                                                            : BinaryOp::Operator::GreaterGreater;
         expression = std::make_shared<BinaryOp>(expression, ParseSum(), op);
     }
     return expression;
@@ -563,7 +911,7 @@ std::shared_ptr<Expression> Parser::ParseSum()
 
 std::shared_ptr<Expression> Parser::ParseTerm()
 {
-    auto term = ParseUnary();
+    auto term = ParseConversion();
     std::optional<Token> token;
     while ((token = ConsumeIf({TokenType::Asterisk, TokenType::Slash, TokenType::Percent})))
     {
@@ -590,11 +938,33 @@ std::shared_ptr<Expression> Parser::ParseTerm()
                 throw ParserError("ParseTerm()");
             }
         }
-        term = std::make_shared<BinaryOp>(term, ParseFactor(), op);
+        term = std::make_shared<BinaryOp>(term, ParseConversion(), op);
     }
     return term;
 }
 
+std::shared_ptr<Expression> Parser::ParseConversion()
+{
+    auto expression = ParseUnary();
+    while (ConsumeIfKeyword(Keyword::As))
+    {
+        is_parsing_conversion_ = true;
+        auto annotation = TryParseUnqualifiedTypeAnnotation();
+        is_parsing_conversion_ = false;
+        if (!annotation)
+        {
+            throw ParserError(std::format(
+                "Expected type annotation after '{}', got token '{}' of type '{}' instead.",
+                Keyword::As,
+                Peek().lexeme,
+                str(Peek().type)
+            ));
+        }
+        expression = std::make_shared<Conversion>(expression, annotation);
+    }
+    return expression;
+}
+
 std::shared_ptr<Expression> Parser::ParseUnary()
 {
     // TODO Refactor into using loop instead of recursion
@@ -626,6 +996,12 @@ std::shared_ptr<Expression> Parser::ParseUnary()
             auto expression = ParseUnary();
             return std::make_shared<UnaryOp>(expression, UnaryOp::Operator::Ampersand);
         }
+        case TokenType::Tilde:
+        {
+            Consume();
+            auto expression = ParseUnary();
+            return std::make_shared<UnaryOp>(expression, UnaryOp::Operator::Tilde);
+        }
         default:
         {
             return ParseFactor();
@@ -662,6 +1038,10 @@ std::shared_ptr<Expression> Parser::ParseCallsDerefsAndMemberAccessors()
         {
             expression = std::make_shared<UnaryOp>(expression, UnaryOp::Operator::Caret);
         }
+        else if (Peek().type == TokenType::OpeningBracket)
+        {
+            expression = ParseElementAccessorOrSlicing(expression);
+        }
         else
         {
             break;
@@ -670,6 +1050,31 @@ std::shared_ptr<Expression> Parser::ParseCallsDerefsAndMemberAccessors()
     return expression;
 }
 
+std::shared_ptr<Expression> Parser::ParseElementAccessorOrSlicing(std::shared_ptr<Expression> object)
+{
+    Expect(TokenType::OpeningBracket);
+
+    std::shared_ptr<Expression> lower{nullptr};
+    if (Peek().type != TokenType::DotDot)
+    {
+        lower = ParseExpression();
+        if (ConsumeIf(TokenType::ClosingBracket))
+        {
+            return std::make_shared<ElementAccessor>(object, lower);
+        }
+    }
+
+    Expect(TokenType::DotDot);
+    std::shared_ptr<Expression> upper{nullptr};
+    if (Peek().type != TokenType::ClosingBracket)
+    {
+        upper = ParseExpression();
+    }
+    Expect(TokenType::ClosingBracket);
+
+    return std::make_shared<Slicing>(object, lower, upper);
+}
+
 std::shared_ptr<Expression> Parser::ParseAtomicExpression()
 {
     Token token = Peek();
@@ -686,16 +1091,25 @@ std::shared_ptr<Expression> Parser::ParseAtomicExpression()
         case TokenType::Identifier:
         {
             auto identifier = ParseIdentifier();
+
+            // type arguments in expressions are preceded by '::' to distinguish them from comparisons
+            std::shared_ptr<TypeArgumentListAnnotation> type_arguments{nullptr};
+            if (ConsumeIf(TokenType::ColonColon))
+            {
+                type_arguments = ParseTypeArgumentList();
+            }
+
             if (Peek().type == TokenType::OpeningBrace)
             {
                 auto member_initializer_list = ParseMemberInitializerList();
                 return std::make_shared<Initializer>(
-                    std::make_shared<SimpleTypeAnnotation>(identifier), std::move(member_initializer_list)
+                    std::make_shared<SimpleTypeAnnotation>(identifier, type_arguments),
+                    std::move(member_initializer_list)
                 );
             }
             else
             {
-                return std::make_shared<Variable>(identifier);
+                return std::make_shared<Variable>(identifier, type_arguments);
             }
         }
         case TokenType::IntegerLiteral:
@@ -703,6 +1117,11 @@ std::shared_ptr<Expression> Parser::ParseAtomicExpression()
             Consume();
             return std::make_shared<IntegerLiteral>(std::any_cast<std::int64_t>(token.data));
         }
+        case TokenType::FloatLiteral:
+        {
+            Consume();
+            return std::make_shared<FloatLiteral>(std::any_cast<double>(token.data));
+        }
         case TokenType::CharacterLiteral:
         {
             Consume();
@@ -717,6 +1136,10 @@ std::shared_ptr<Expression> Parser::ParseAtomicExpression()
         {
             return ParseFunction();
         }
+        case TokenType::OpeningBracket:
+        {
+            return ParseArrayLiteral();
+        }
         case TokenType::Keyword:
         {
             std::string keyword = std::any_cast<std::string>(token.data);
@@ -769,6 +1192,8 @@ std::shared_ptr<Expression> Parser::ParseAllocation()
 {
     ExpectKeyword(Keyword::New);
 
+    bool is_uninitialized = ConsumeIfKeyword(Keyword::Uninitialized);
+
     std::shared_ptr<Expression> size{nullptr};
     if (ConsumeIf(TokenType::OpeningBracket))
     {
@@ -779,12 +1204,39 @@ std::shared_ptr<Expression> Parser::ParseAllocation()
     auto annotation = TryParseUnqualifiedTypeAnnotation();
 
     std::shared_ptr<MemberInitializerList> member_initializer_list{nullptr};
-    if (Peek().type == TokenType::OpeningBrace)
+    if (!is_uninitialized && Peek().type == TokenType::OpeningBrace)
     {
         member_initializer_list = ParseMemberInitializerList();
     }
 
-    return std::make_shared<Allocation>(annotation, size, member_initializer_list);
+    return std::make_shared<Allocation>(annotation, size, member_initializer_list, is_uninitialized);
+}
+
+std::shared_ptr<Expression> Parser::ParseArrayLiteral()
+{
+    Expect(TokenType::OpeningBracket);
+
+    auto elements = std::make_shared<ArgumentList>();
+    elements->push_back(ParseExpression());
+
+    if (ConsumeIf(TokenType::Semicolon))
+    {
+        auto repetitions = ParseArrayLength();
+        Expect(TokenType::ClosingBracket);
+        return std::make_shared<ArrayLiteral>(elements, repetitions);
+    }
+
+    while (ConsumeIf(TokenType::Comma))
+    {
+        if (Peek().type == TokenType::ClosingBracket)
+        {
+            break;
+        }
+        elements->push_back(ParseExpression());
+    }
+    Expect(TokenType::ClosingBracket);
+
+    return std::make_shared<ArrayLiteral>(elements);
 }
 
 std::shared_ptr<ArgumentList> Parser::ParseArgumentList()
@@ -976,6 +1428,10 @@ std::shared_ptr<TypeAnnotation> Parser::TryParseUnqualifiedTypeAnnotation()
         {
             return ParseFunctionTypeAnnotation();
         }
+        case TokenType::OpeningBracket:
+        {
+            return ParseArrayOrSliceTypeAnnotation();
+        }
         case TokenType::Keyword:
         {
             if (PeekIsKeyword(Keyword::Method))
@@ -994,7 +1450,14 @@ std::shared_ptr<TypeAnnotation> Parser::TryParseUnqualifiedTypeAnnotation()
 std::shared_ptr<TypeAnnotation> Parser::ParseSimpleTypeAnnotation()
 {
     auto identifier = ParseIdentifier();
-    return std::make_shared<SimpleTypeAnnotation>(identifier);
+
+    std::shared_ptr<TypeArgumentListAnnotation> type_arguments{nullptr};
+    if (ConsumeIf(TokenType::ColonColon) || (Peek().type == TokenType::Less && !is_parsing_conversion_))
+    {
+        type_arguments = ParseTypeArgumentList();
+    }
+
+    return std::make_shared<SimpleTypeAnnotation>(identifier, type_arguments);
 }
 
 std::shared_ptr<TypeAnnotation> Parser::ParseReferenceTypeAnnotation()
@@ -1013,6 +1476,41 @@ std::shared_ptr<TypeAnnotation> Parser::ParseReferenceTypeAnnotation()
     return double_ref;
 }
 
+std::shared_ptr<TypeAnnotation> Parser::ParseArrayOrSliceTypeAnnotation()
+{
+    Expect(TokenType::OpeningBracket);
+
+    // like the base type of references, the element type of slices has its own mutability
+    if (ConsumeIf(TokenType::ClosingBracket))
+    {
+        auto element_type = ParseTypeAnnotation();
+        return std::make_shared<SliceTypeAnnotation>(element_type);
+    }
+
+    auto length = ParseArrayLength();
+    Expect(TokenType::ClosingBracket);
+
+    // the mutability of the elements is that of the array
+    auto element_type = TryParseUnqualifiedTypeAnnotation();
+    if (!element_type)
+    {
+        throw ParserError(std::format("Expected element type of array, got token '{}' instead.", Peek().lexeme));
+    }
+
+    return std::make_shared<ArrayTypeAnnotation>(element_type, length);
+}
+
+std::size_t Parser::ParseArrayLength()
+{
+    auto token = Expect(TokenType::IntegerLiteral);
+    auto length = std::any_cast<std::int64_t>(token.data);
+    if (length <= 0)
+    {
+        throw ParserError(std::format("Length of array must be positive, got '{}' instead.", token.lexeme));
+    }
+    return static_cast<std::size_t>(length);
+}
+
 std::shared_ptr<TypeAnnotation> Parser::ParseFunctionTypeAnnotation()
 {
     auto arguments = ParseParameterListAnnotation();
@@ -1091,11 +1589,58 @@ std::shared_ptr<ParameterListAnnotation> Parser::ParseParameterListAnnotation()
     } while (true);
 }
 
+std::shared_ptr<TypeArgumentListAnnotation> Parser::ParseTypeArgumentList()
+{
+    Expect(TokenType::Less);
+
+    auto arguments = std::make_shared<TypeArgumentListAnnotation>();
+    do
+    {
+        arguments->push_back(ParseTypeAnnotation());
+    } while (!pending_greater_ && ConsumeIf(TokenType::Comma));
+
+    ExpectClosingAngleBracket();
+    return arguments;
+}
+
+std::vector<std::string> Parser::ParseTypeParameterList()
+{
+    Expect(TokenType::Less);
+
+    std::vector<std::string> parameters{};
+    do
+    {
+        auto parameter = std::any_cast<std::string>(Expect(TokenType::Identifier).data);
+        if (std::ranges::contains(parameters, parameter))
+        {
+            throw ParserError(std::format("Duplicate type parameter '{}'.", parameter));
+        }
+        parameters.push_back(parameter);
+    } while (ConsumeIf(TokenType::Comma));
+
+    Expect(TokenType::Greater);
+    return parameters;
+}
+
+void Parser::ExpectClosingAngleBracket()
+{
+    // in nested lists such as 'Pair<Pair<I64>>', the token '>>' closes two lists
+    if (pending_greater_)
+    {
+        pending_greater_ = false;
+    }
+    else if (Expect({TokenType::Greater, TokenType::GreaterGreater}).type == TokenType::GreaterGreater)
+    {
+        pending_greater_ = true;
+    }
+}
+
 std::shared_ptr<TypeExpression> Parser::ParseStruct()
 {
+    bool is_packed = ConsumeIfKeyword(Keyword::Packed);
     ExpectKeyword(Keyword::Structure);
     auto members = ParseStructMemberDeclarationList();
-    return std::make_shared<StructExpression>(members);
+    return std::make_shared<StructExpression>(members, is_packed);
 }
 
 std::shared_ptr<StructMemberDeclarationList> Parser::ParseStructMemberDeclarationList()
@@ -1168,8 +1713,63 @@ std::shared_ptr<MemberInitializerList> Parser::ParseMemberInitializerList()
     return member_initializer_list;
 }
 
+std::vector<std::string> Parser::ParseFunctionAttributes()
+{
+    std::vector<std::string> attributes{};
+    while (true)
+    {
+        auto attribute =
+            std::ranges::find_if(kFunctionAttributes, [this](auto keyword) { return PeekIsKeyword(keyword); });
+        if (attribute == kFunctionAttributes.end())
+        {
+            return attributes;
+        }
+        Consume();
+
+        if (std::ranges::find(attributes, *attribute) != attributes.end())
+        {
+            throw ParserError(std::format("Function attribute '{}' is given more than once.", *attribute));
+        }
+        attributes.emplace_back(*attribute);
+    }
+}
+
+void Parser::SetFunctionAttributes(Function& function, const std::vector<std::string>& attributes)
+{
+    for (const auto& attribute : attributes)
+    {
+        if (attribute == Keyword::Constant)
+        {
+            function.is_const = true;
+        }
+        else if (attribute == Keyword::Inline || attribute == Keyword::NoInline)
+        {
+            if (function.inlining != Function::Inlining::Default)
+            {
+                throw ParserError("Function attributes 'inline' and 'noinline' are mutually exclusive.");
+            }
+            function.inlining =
+                (attribute == Keyword::Inline) ? Function::Inlining::Always : Function::Inlining::Never;
+        }
+        else if (attribute == Keyword::Hot || attribute == Keyword::Cold)
+        {
+            if (function.temperature != Function::Temperature::Default)
+            {
+                throw ParserError("Function attributes 'hot' and 'cold' are mutually exclusive.");
+            }
+            function.temperature =
+                (attribute == Keyword::Hot) ? Function::Temperature::Hot : Function::Temperature::Cold;
+        }
+        else if (attribute == Keyword::FastMath)
+        {
+            function.is_fast_math = true;
+        }
+    }
+}
+
 std::shared_ptr<Declaration> Parser::ParseAlternativeFunctionDeclaration()
 {
+    auto attributes = ParseFunctionAttributes();
     ExpectKeyword(Keyword::Function);
 
     auto identifier = ParseIdentifier();
@@ -1191,6 +1791,7 @@ std::shared_ptr<Declaration> Parser::ParseAlternativeFunctionDeclaration()
     );
 
     auto function = std::make_shared<Function>(parameters, nullptr, return_type, statements, current_namespace_);
+    SetFunctionAttributes(*function, attributes);
 
     current_namespace_ = old_namespace;
 
@@ -1199,6 +1800,7 @@ std::shared_ptr<Declaration> Parser::ParseAlternativeFunctionDeclaration()
 
 std::shared_ptr<TypeDeclaration> Parser::ParseAlternativeStructDeclaration()
 {
+    bool is_packed = ConsumeIfKeyword(Keyword::Packed);
     ExpectKeyword(Keyword::Structure);
 
     auto identifier = ParseIdentifier();
@@ -1209,7 +1811,7 @@ std::shared_ptr<TypeDeclaration> Parser::ParseAlternativeStructDeclaration()
 
     current_namespace_ = old_namespace;
 
-    auto struct_expression = std::make_shared<StructExpression>(members);
+    auto struct_expression = std::make_shared<StructExpression>(members, is_packed);
     return std::make_shared<TypeDeclaration>(identifier, struct_expression);
 }
 
@@ -1231,6 +1833,7 @@ std::shared_ptr<TypeDeclaration> Parser::ParseAlternativeEnumDeclaration()
 
 std::shared_ptr<Declaration> Parser::ParseAlternativeMethodDeclaration()
 {
+    auto attributes = ParseFunctionAttributes();
     ExpectKeyword(Keyword::Method);
 
     auto identifier = ParseIdentifier();
@@ -1255,6 +1858,7 @@ std::shared_ptr<Declaration> Parser::ParseAlternativeMethodDeclaration()
     current_namespace_ = old_namespace;
 
     auto function = std::make_shared<Function>(parameters, nullptr, return_type, statements, current_namespace_);
+    SetFunctionAttributes(*function, attributes);
 
     return std::make_shared<Declaration>(identifier, method_annotation, function);
 }
@@ -1266,9 +1870,11 @@ Identifier Parser::ParseIdentifier()
     auto first = std::any_cast<std::string>(Expect(TokenType::Identifier).data);
     parts.push_back(first);
 
-    while (ConsumeIf(TokenType::ColonColon))
+    // '::' may also introduce type arguments, as in 'max::<I64>'
+    while (Peek().type == TokenType::ColonColon && PeekNext().type == TokenType::Identifier)
     {
-        auto next = std::any_cast<std::string>(Expect(TokenType::Identifier).data);
+        Consume();
+        auto next = std::any_cast<std::string>(Consume().data);
         parts.push_back(next);
     }
 
@@ -40,9 +40,15 @@ class Parser
     std::size_t pos_{0};
     Identifier current_namespace_{};
 
+    // set while parsing the target type of a conversion, where '<' is a comparison rather than type arguments
+    bool is_parsing_conversion_{false};
+    // set when the first '>' of a '>>' token has closed a type argument list
+    bool pending_greater_{false};
+
     Token Peek();
     Token PeekNext();
     bool PeekIsKeyword(std::string_view keyword);
+    bool PeekIsCallableDeclaration(std::string_view keyword);
     Token Consume();
     bool ConsumeIf(TokenType type);
     std::optional<Token> ConsumeIf(std::initializer_list<TokenType> type);
@@ -55,6 +61,9 @@ class Parser
 
     void ParseNamespaceStatementBlock(TokenType delimiter, Module& module);
     void ParseGlobalStatement(Module& module);
+    bool PeekIsGenericDeclaration();
+    void ParseGenericDeclaration(Module& module);
+    static GenericDeclaration::Instance ParseGenericInstance(const std::vector<Token>& tokens, Identifier namespace_);
 
     std::shared_ptr<StatementBlock> ParseStatementBlock(TokenType delimiter);
     std::shared_ptr<Statement> ParseStatement();
@@ -64,7 +73,10 @@ class Parser
     std::shared_ptr<Statement> ParseExpressionStatement();
     std::shared_ptr<Statement> ParseReturnStatement();
     std::shared_ptr<Statement> ParseConditionalStatement();
+    std::shared_ptr<Statement> ParseMatchStatement();
+    std::shared_ptr<MatchCase> ParseMatchCase();
     std::shared_ptr<Statement> ParseWhileLoop();
+    std::shared_ptr<Statement> ParseForLoop();
     std::shared_ptr<Statement> ParseDeallocation();
 
     std::shared_ptr<Expression> ParseExpression();
@@ -73,14 +85,21 @@ class Parser
     std::shared_ptr<Expression> ParseConjunction();
     std::shared_ptr<Expression> ParseEquality();
     std::shared_ptr<Expression> ParseComparison();
+    std::shared_ptr<Expression> ParseBitwiseOr();
+    std::shared_ptr<Expression> ParseBitwiseXor();
+    std::shared_ptr<Expression> ParseBitwiseAnd();
+    std::shared_ptr<Expression> ParseShift();
     std::shared_ptr<Expression> ParseSum();
     std::shared_ptr<Expression> ParseTerm();
+    std::shared_ptr<Expression> ParseConversion();
     std::shared_ptr<Expression> ParseUnary();
     std::shared_ptr<Expression> ParseFactor();
     std::shared_ptr<Expression> ParseCallsDerefsAndMemberAccessors();
+    std::shared_ptr<Expression> ParseElementAccessorOrSlicing(std::shared_ptr<Expression> object);
     std::shared_ptr<Expression> ParseAtomicExpression();
     std::shared_ptr<Expression> ParseFunction();
     std::shared_ptr<Expression> ParseAllocation();
+    std::shared_ptr<Expression> ParseArrayLiteral();
 
     std::shared_ptr<ArgumentList> ParseArgumentList();
     std::shared_ptr<ParameterDeclarationList> ParseParameterDeclarationList();
@@ -92,15 +111,22 @@ class Parser
     std::shared_ptr<TypeAnnotation> TryParseUnqualifiedTypeAnnotation();
     std::shared_ptr<TypeAnnotation> ParseSimpleTypeAnnotation();
     std::shared_ptr<TypeAnnotation> ParseReferenceTypeAnnotation();
+    std::shared_ptr<TypeAnnotation> ParseArrayOrSliceTypeAnnotation();
+    std::size_t ParseArrayLength();
     std::shared_ptr<TypeAnnotation> ParseFunctionTypeAnnotation();
     std::shared_ptr<TypeAnnotation> ParseMethodTypeAnnotation();
     std::shared_ptr<ParameterListAnnotation> ParseParameterListAnnotation();
+    std::shared_ptr<TypeArgumentListAnnotation> ParseTypeArgumentList();
+    std::vector<std::string> ParseTypeParameterList();
+    void ExpectClosingAngleBracket();
 
     std::shared_ptr<TypeExpression> ParseStruct();
     std::shared_ptr<StructMemberDeclarationList> ParseStructMemberDeclarationList();
     std::shared_ptr<TypeExpression> ParseEnum();
     std::shared_ptr<EnumMemberDeclarationList> ParseEnumMemberDeclarationList();
 
+    std::vector<std::string> ParseFunctionAttributes();
+    void SetFunctionAttributes(Function& function, const std::vector<std::string>& attributes);
     std::shared_ptr<Declaration> ParseAlternativeFunctionDeclaration();
     std::shared_ptr<TypeDeclaration> ParseAlternativeStructDeclaration();
     std::shared_ptr<TypeDeclaration> ParseAlternativeEnumDeclaration();
@@ -0,0 +1,494 @@
+#include "l0/semantics/bounds_check_elimination.h"
+
+#include <utility>
+
+namespace l0::detail
+{
+
+BoundsCheckElimination::BoundsCheckElimination(const Module& module)
+    : module_{module}
+{
+}
+
+void BoundsCheckElimination::Run()
+{
+    for (auto callable : module_.callables)
+    {
+        callable->Accept(*this);
+    }
+
+    is_collecting_ = false;
+    for (auto callable : module_.callables)
+    {
+        callable->Accept(*this);
+    }
+}
+
+void BoundsCheckElimination::Visit(const StatementBlock& statement_block)
+{
+    for (auto statement : statement_block.statements)
+    {
+        statement->Accept(*this);
+    }
+}
+
+void BoundsCheckElimination::Visit(const Declaration& declaration)
+{
+    declaration.initializer->Accept(*this);
+
+    if (is_collecting_)
+    {
+        VariableKey key{declaration.scope.get(), declaration.identifier.ToString()};
+        non_negative_variables_[key] = IsNonNegativeLiteral(*declaration.initializer);
+    }
+}
+
+void BoundsCheckElimination::Visit(const TypeDeclaration&) {}
+
+void BoundsCheckElimination::Visit(const ExpressionStatement& expression_statement)
+{
+    expression_statement.expression->Accept(*this);
+}
+
+void BoundsCheckElimination::Visit(const ReturnStatement& return_statement)
+{
+    return_statement.value->Accept(*this);
+}
+
+void BoundsCheckElimination::Visit(const ConditionalStatement& conditional_statement)
+{
+    conditional_statement.condition->Accept(*this);
+
+    auto outer_facts = facts_.size();
+    if (!is_collecting_)
+    {
+        AddFacts(*conditional_statement.condition);
+    }
+    conditional_statement.then_block->Accept(*this);
+    facts_.resize(outer_facts);
+
+    if (conditional_statement.else_block)
+    {
+        conditional_statement.else_block->Accept(*this);
+    }
+}
+
+void BoundsCheckElimination::Visit(const MatchStatement& match_statement)
+{
+    match_statement.subject->Accept(*this);
+    for (const auto& match_case : *match_statement.cases)
+    {
+        match_case->body->Accept(*this);
+    }
+    if (match_statement.else_block)
+    {
+        match_statement.else_block->Accept(*this);
+    }
+}
+
+void BoundsCheckElimination::Visit(const WhileLoop& while_loop)
+{
+    if (is_collecting_)
+    {
+        enclosing_loops_.push_back(&while_loop);
+        while_loop.condition->Accept(*this);
+        while_loop.body->Accept(*this);
+        enclosing_loops_.pop_back();
+        return;
+    }
+
+    // facts established before the loop do not hold in later iterations if the loop reassigns their index
+    for (const auto& assigned_variable : loop_assignments_[&while_loop])
+    {
+        InvalidateFacts(assigned_variable);
+    }
+
+    while_loop.condition->Accept(*this);
+
+    auto outer_facts = facts_.size();
+    AddFacts(*while_loop.condition);
+    while_loop.body->Accept(*this);
+    facts_.resize(outer_facts);
+}
+
+void BoundsCheckElimination::Visit(const ForLoop& for_loop)
+{
+    for_loop.begin->Accept(*this);
+    for_loop.end->Accept(*this);
+
+    VariableKey key{for_loop.scope.get(), for_loop.variable};
+    if (is_collecting_)
+    {
+        non_negative_variables_[key] = IsNonNegativeLiteral(*for_loop.begin);
+        enclosing_loops_.push_back(&for_loop);
+        for_loop.body->Accept(*this);
+        enclosing_loops_.pop_back();
+        return;
+    }
+
+    for (const auto& assigned_variable : loop_assignments_[&for_loop])
+    {
+        InvalidateFacts(assigned_variable);
+    }
+
+    // the loop variable is immutable and below the end of the range in every iteration
+    auto outer_facts = facts_.size();
+    AddFact(key, *for_loop.end);
+    for_loop.body->Accept(*this);
+    facts_.resize(outer_facts);
+}
+
+void BoundsCheckElimination::Visit(const Deallocation& deallocation)
+{
+    deallocation.reference->Accept(*this);
+}
+
+void BoundsCheckElimination::Visit(const Assignment& assignment)
+{
+    assignment.expression->Accept(*this);
+
+    auto target = dynamic_pointer_cast<Variable>(assignment.target);
+    if (!target)
+    {
+        assignment.target->Accept(*this);
+        return;
+    }
+
+    VariableKey key{target->scope.get(), target->resolved_name.ToString()};
+    if (!is_collecting_)
+    {
+        InvalidateFacts(key);
+        return;
+    }
+
+    for (auto loop : enclosing_loops_)
+    {
+        loop_assignments_[loop].insert(key);
+    }
+
+    // variables stay non-negative if they are only assigned non-negative literals or incremented by them
+    if (!IsNonNegativeLiteral(*assignment.expression) && !IsIncrement(*assignment.expression, key, *target->type))
+    {
+        non_negative_variables_[key] = false;
+    }
+}
+
+void BoundsCheckElimination::Visit(const UnaryOp& unary_op)
+{
+    unary_op.operand->Accept(*this);
+
+    auto variable = dynamic_pointer_cast<Variable>(unary_op.operand);
+    if (is_collecting_ && variable && unary_op.overload == UnaryOp::Overload::AddressOf)
+    {
+        address_taken_variables_.insert({variable->scope.get(), variable->resolved_name.ToString()});
+    }
+}
+
+void BoundsCheckElimination::Visit(const BinaryOp& binary_op)
+{
+    binary_op.left->Accept(*this);
+    binary_op.right->Accept(*this);
+}
+
+void BoundsCheckElimination::Visit(const Variable&) {}
+
+void BoundsCheckElimination::Visit(const MemberAccessor& member_accessor)
+{
+    member_accessor.object->Accept(*this);
+}
+
+void BoundsCheckElimination::Visit(const Call& call)
+{
+    call.function->Accept(*this);
+    for (const auto& argument : *call.arguments)
+    {
+        argument->Accept(*this);
+    }
+}
+
+void BoundsCheckElimination::Visit(const UnitLiteral&) {}
+void BoundsCheckElimination::Visit(const BooleanLiteral&) {}
+void BoundsCheckElimination::Visit(const IntegerLiteral&) {}
+void BoundsCheckElimination::Visit(const FloatLiteral&) {}
+void BoundsCheckElimination::Visit(const CharacterLiteral&) {}
+void BoundsCheckElimination::Visit(const StringLiteral&) {}
+
+void BoundsCheckElimination::Visit(const Function& function)
+{
+    if (function.captures)
+    {
+        for (const auto& capture : *function.captures)
+        {
+            capture->Accept(*this);
+        }
+    }
+
+    // the body may run at any time, so nothing known at the function literal carries over
+    auto outer_facts = std::exchange(facts_, {});
+    auto outer_loops = std::exchange(enclosing_loops_, {});
+    function.body->Accept(*this);
+    facts_ = std::move(outer_facts);
+    enclosing_loops_ = std::move(outer_loops);
+}
+
+void BoundsCheckElimination::Visit(const Initializer& initializer)
+{
+    for (const auto& member_initializer : *initializer.member_initializers)
+    {
+        member_initializer->value->Accept(*this);
+    }
+}
+
+void BoundsCheckElimination::Visit(const Allocation& allocation)
+{
+    if (allocation.size)
+    {
+        allocation.size->Accept(*this);
+    }
+    if (allocation.member_initializers)
+    {
+        for (const auto& member_initializer : *allocation.member_initializers)
+        {
+            member_initializer->value->Accept(*this);
+        }
+    }
+}
+
+void BoundsCheckElimination::Visit(const Conversion& conversion)
+{
+    conversion.operand->Accept(*this);
+}
+
+void BoundsCheckElimination::Visit(const ElementAccessor& element_accessor)
+{
+    element_accessor.object->Accept(*this);
+    element_accessor.index->Accept(*this);
+
+    if (!is_collecting_)
+    {
+        const auto& object = *element_accessor.dereferenced_object;
+        element_accessor.needs_bounds_check =
+            !element_accessor.shuffle_mask && !IsInRange(*element_accessor.index, object, false);
+    }
+}
+
+void BoundsCheckElimination::Visit(const ArrayLiteral& array_literal)
+{
+    for (const auto& element : *array_literal.elements)
+    {
+        element->Accept(*this);
+    }
+}
+
+void BoundsCheckElimination::Visit(const Slicing& slicing)
+{
+    slicing.object->Accept(*this);
+    if (slicing.lower)
+    {
+        slicing.lower->Accept(*this);
+    }
+    if (slicing.upper)
+    {
+        slicing.upper->Accept(*this);
+    }
+
+    if (is_collecting_)
+    {
+        return;
+    }
+
+    // omitted bounds are the start and end of the array or slice, and references have no length to check against
+    const auto& object = *slicing.dereferenced_object;
+    bool is_reference = dynamic_pointer_cast<ReferenceType>(slicing.dereferenced_object_type) != nullptr;
+    bool is_lower_in_range =
+        !slicing.lower || (!is_reference && !slicing.upper && IsInRange(*slicing.lower, object, true));
+    bool is_upper_in_range = !slicing.upper || is_reference || IsInRange(*slicing.upper, object, true);
+
+    auto lower_literal = dynamic_pointer_cast<IntegerLiteral>(slicing.lower);
+    auto upper_literal = dynamic_pointer_cast<IntegerLiteral>(slicing.upper);
+    if (lower_literal && upper_literal)
+    {
+        is_lower_in_range = lower_literal->value >= 0 && lower_literal->value <= upper_literal->value;
+    }
+
+    slicing.needs_bounds_check = !is_lower_in_range || !is_upper_in_range;
+}
+
+void BoundsCheckElimination::AddFacts(const Expression& condition)
+{
+    auto binary_op = dynamic_cast<const BinaryOp*>(&condition);
+    if (!binary_op)
+    {
+        return;
+    }
+
+    const Expression* index{nullptr};
+    const Expression* bound{nullptr};
+    switch (binary_op->overload)
+    {
+        case BinaryOp::Overload::BooleanConjunction:
+        {
+            AddFacts(*binary_op->left);
+            AddFacts(*binary_op->right);
+            return;
+        }
+        case BinaryOp::Overload::IntegerLess:
+        case BinaryOp::Overload::UnsignedIntegerLess:
+        {
+            index = binary_op->left.get();
+            bound = binary_op->right.get();
+            break;
+        }
+        case BinaryOp::Overload::IntegerGreater:
+        case BinaryOp::Overload::UnsignedIntegerGreater:
+        {
+            index = binary_op->right.get();
+            bound = binary_op->left.get();
+            break;
+        }
+        default:
+        {
+            return;
+        }
+    }
+
+    if (auto index_variable = GetIndexVariable(*index))
+    {
+        AddFact(*index_variable, *bound);
+    }
+}
+
+void BoundsCheckElimination::AddFact(const VariableKey& index, const Expression& bound)
+{
+    if (auto literal = dynamic_cast<const IntegerLiteral*>(&bound))
+    {
+        facts_.push_back({index, literal->value, true});
+        return;
+    }
+
+    auto length = dynamic_cast<const MemberAccessor*>(&bound);
+    if (!length || length->builtin_member != MemberAccessor::BuiltinMember::Length)
+    {
+        return;
+    }
+    if (auto fixed_length = GetFixedLength(*length->dereferenced_object->type))
+    {
+        facts_.push_back({index, static_cast<std::int64_t>(*fixed_length), true});
+        return;
+    }
+
+    // slices held by mutable variables or accessed through references may change
+    auto slice = dynamic_pointer_cast<Variable>(length->object);
+    if (slice && dynamic_pointer_cast<SliceType>(slice->type) && slice->type->mutability == TypeQualifier::Constant)
+    {
+        facts_.push_back({index, VariableKey{slice->scope.get(), slice->resolved_name.ToString()}, true});
+    }
+}
+
+void BoundsCheckElimination::InvalidateFacts(const VariableKey& index)
+{
+    for (auto& fact : facts_)
+    {
+        if (fact.index == index)
+        {
+            fact.is_valid = false;
+        }
+    }
+}
+
+bool BoundsCheckElimination::IsInRange(const Expression& index, const Expression& object, bool is_upper_bound) const
+{
+    // an upper bound of a slicing may also be equal to the length
+    auto fixed_length = GetFixedLength(*object.type);
+    auto length = static_cast<std::int64_t>(fixed_length.value_or(0));
+
+    if (auto literal = dynamic_cast<const IntegerLiteral*>(&index))
+    {
+        return fixed_length && literal->value >= 0
+            && (is_upper_bound ? literal->value <= length : literal->value < length);
+    }
+
+    auto index_variable = GetIndexVariable(index);
+    if (!index_variable)
+    {
+        return false;
+    }
+
+    auto object_variable = dynamic_cast<const Variable*>(&object);
+    for (const auto& fact : facts_)
+    {
+        if (!fact.is_valid || fact.index != *index_variable)
+        {
+            continue;
+        }
+        if (auto bound = std::get_if<std::int64_t>(&fact.bound))
+        {
+            if (fixed_length && *bound <= length)
+            {
+                return true;
+            }
+        }
+        else if (object_variable
+                 && std::get<VariableKey>(fact.bound)
+                        == VariableKey{object_variable->scope.get(), object_variable->resolved_name.ToString()})
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::optional<BoundsCheckElimination::VariableKey> BoundsCheckElimination::GetIndexVariable(
+    const Expression& index
+) const
+{
+    auto variable = dynamic_cast<const Variable*>(&index);
+    auto integer_type = variable ? dynamic_pointer_cast<IntegerType>(variable->type) : nullptr;
+    if (!integer_type)
+    {
+        return std::nullopt;
+    }
+
+    VariableKey key{variable->scope.get(), variable->resolved_name.ToString()};
+    if (address_taken_variables_.contains(key))
+    {
+        return std::nullopt;
+    }
+
+    auto non_negative = non_negative_variables_.find(key);
+    if (integer_type->is_signed && (non_negative == non_negative_variables_.end() || !non_negative->second))
+    {
+        return std::nullopt;
+    }
+    return key;
+}
+
+bool BoundsCheckElimination::IsNonNegativeLiteral(const Expression& expression)
+{
+    auto literal = dynamic_cast<const IntegerLiteral*>(&expression);
+    return literal && literal->value >= 0;
+}
+
+bool BoundsCheckElimination::IsIncrement(const Expression& expression, const VariableKey& variable, const Type& type)
+{
+    auto binary_op = dynamic_cast<const BinaryOp*>(&expression);
+    if (!binary_op || binary_op->overload != BinaryOp::Overload::IntegerAddition
+        || !IsNonNegativeLiteral(*binary_op->right))
+    {
+        return false;
+    }
+
+    // Unsigned variables wrap around to zero, but signed ones to negative values. Only 64-bit variables incremented in
+    // small steps are safe from that, since it would take them at least 2^55 increments.
+    auto integer_type = dynamic_cast<const IntegerType*>(&type);
+    auto increment = dynamic_pointer_cast<IntegerLiteral>(binary_op->right)->value;
+    if (integer_type && integer_type->is_signed && (integer_type->width < 64 || increment > kMaxSignedIncrement))
+    {
+        return false;
+    }
+
+    auto operand = dynamic_pointer_cast<Variable>(binary_op->left);
+    return operand && VariableKey{operand->scope.get(), operand->resolved_name.ToString()} == variable;
+}
+
+}  // namespace l0::detail
@@ -0,0 +1,111 @@
+#ifndef L0_SEMANTICS_BOUNDS_CHECK_ELIMINATION_H
+#define L0_SEMANTICS_BOUNDS_CHECK_ELIMINATION_H
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "l0/ast/expression.h"
+#include "l0/ast/module.h"
+#include "l0/ast/scope.h"
+#include "l0/ast/statement.h"
+
+namespace l0::detail
+{
+
+/// @brief Marks element accesses and slicings whose bounds are proven to be in range, so that no bounds checks are
+/// generated for them.
+///
+/// Literal indices are in range if they are within the length of the indexed array or vector. Variable indices are in
+/// range if the condition of an enclosing loop or conditional statement compares them against a literal not exceeding
+/// that length, or against the length of the indexed slice, and they are not reassigned in between, e.g. for loop
+/// induction variables checked against `len`. The same holds for the variables of for loops whose range ends at such a
+/// literal or length. Such variables must be unsigned or only ever be initialized with non-negative literals and, if
+/// they are 64 bits wide, incremented by small ones, and their address must not be taken. Slices are indexed through
+/// immutable variables only, so their length cannot change.
+class BoundsCheckElimination : private IConstExpressionVisitor, private IConstStatementVisitor
+{
+   public:
+    BoundsCheckElimination(const Module& module);
+    void Run();
+
+   private:
+    struct VariableKey
+    {
+        const Scope* scope;
+        std::string name;
+
+        auto operator<=>(const VariableKey&) const = default;
+    };
+
+    // `index < bound`, where the bound is a constant or the length of the slice held by a variable
+    struct Fact
+    {
+        VariableKey index;
+        std::variant<std::int64_t, VariableKey> bound;
+        bool is_valid;
+    };
+
+    // the largest increment that keeps a signed 64-bit variable non-negative in practice
+    static constexpr std::int64_t kMaxSignedIncrement = 256;
+
+    const Module& module_;
+
+    // The first traversal collects which variables are assigned in which loops, and which may be negative; the second
+    // one derives facts from conditions and marks the accesses.
+    bool is_collecting_{true};
+
+    std::vector<const Statement*> enclosing_loops_{};
+    std::map<const Statement*, std::set<VariableKey>> loop_assignments_{};
+    std::map<VariableKey, bool> non_negative_variables_{};
+    std::set<VariableKey> address_taken_variables_{};
+
+    std::vector<Fact> facts_{};
+
+    void Visit(const StatementBlock& statement_block) override;
+    void Visit(const Declaration& declaration) override;
+    void Visit(const TypeDeclaration& type_declaration) override;
+    void Visit(const ExpressionStatement& expression_statement) override;
+    void Visit(const ReturnStatement& return_statement) override;
+    void Visit(const ConditionalStatement& conditional_statement) override;
+    void Visit(const MatchStatement& match_statement) override;
+    void Visit(const WhileLoop& while_loop) override;
+    void Visit(const ForLoop& for_loop) override;
+    void Visit(const Deallocation& deallocation) override;
+
+    void Visit(const Assignment& assignment) override;
+    void Visit(const UnaryOp& unary_op) override;
+    void Visit(const BinaryOp& binary_op) override;
+    void Visit(const Variable& variable) override;
+    void Visit(const MemberAccessor& member_accessor) override;
+    void Visit(const Call& call) override;
+    void Visit(const UnitLiteral& literal) override;
+    void Visit(const BooleanLiteral& literal) override;
+    void Visit(const IntegerLiteral& literal) override;
+    void Visit(const FloatLiteral& literal) override;
+    void Visit(const CharacterLiteral& literal) override;
+    void Visit(const StringLiteral& literal) override;
+    void Visit(const Function& function) override;
+    void Visit(const Initializer& initializer) override;
+    void Visit(const Allocation& allocation) override;
+    void Visit(const Conversion& conversion) override;
+    void Visit(const ElementAccessor& element_accessor) override;
+    void Visit(const ArrayLiteral& array_literal) override;
+    void Visit(const Slicing& slicing) override;
+
+    void AddFacts(const Expression& condition);
+    void AddFact(const VariableKey& index, const Expression& bound);
+    void InvalidateFacts(const VariableKey& index);
+    bool IsInRange(const Expression& index, const Expression& object, bool is_upper_bound) const;
+    std::optional<VariableKey> GetIndexVariable(const Expression& index) const;
+    static bool IsNonNegativeLiteral(const Expression& expression);
+    static bool IsIncrement(const Expression& expression, const VariableKey& variable, const Type& type);
+};
+
+}  // namespace l0::detail
+
+#endif
@@ -0,0 +1,953 @@
+#include "l0/semantics/const_evaluator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <ranges>
+
+#include "l0/semantics/semantic_error.h"
+
+namespace l0::detail
+{
+
+std::optional<ConstantValue> GetLiteralValue(const Expression& expression)
+{
+    if (auto literal = dynamic_cast<const BooleanLiteral*>(&expression))
+    {
+        return literal->value;
+    }
+    if (auto literal = dynamic_cast<const IntegerLiteral*>(&expression))
+    {
+        return literal->value;
+    }
+    if (auto literal = dynamic_cast<const FloatLiteral*>(&expression))
+    {
+        return literal->value;
+    }
+    if (auto literal = dynamic_cast<const CharacterLiteral*>(&expression))
+    {
+        return literal->value;
+    }
+    return std::nullopt;
+}
+
+std::optional<std::int64_t> GetOrdinal(const ConstantValue& value)
+{
+    if (auto boolean = std::get_if<bool>(&value))
+    {
+        return *boolean ? 1 : 0;
+    }
+    if (auto integer = std::get_if<std::int64_t>(&value))
+    {
+        return *integer;
+    }
+    if (auto character = std::get_if<char8_t>(&value))
+    {
+        return *character;
+    }
+    if (auto member = std::get_if<EnumValue>(&value))
+    {
+        return static_cast<std::int64_t>(member->index);
+    }
+    return std::nullopt;
+}
+
+const MatchCase* FindMatchCase(const MatchStatement& match_statement, std::int64_t subject)
+{
+    for (const auto& match_case : *match_statement.cases)
+    {
+        for (const auto& pattern : *match_case->patterns)
+        {
+            if (pattern->lower <= subject && subject <= pattern->upper)
+            {
+                return match_case.get();
+            }
+        }
+    }
+    return nullptr;
+}
+
+ConstantValue WrapToType(const ConstantValue& value, const Type& type)
+{
+    if (auto floating = std::get_if<double>(&value))
+    {
+        auto float_type = dynamic_cast<const FloatType*>(&type);
+        return (float_type && float_type->width == 32) ? double{static_cast<float>(*floating)} : *floating;
+    }
+
+    auto integer = std::get_if<std::int64_t>(&value);
+    auto integer_type = dynamic_cast<const IntegerType*>(&type);
+    if (!integer || !integer_type || integer_type->width == 64)
+    {
+        return value;
+    }
+
+    auto shift = 64 - integer_type->width;
+    auto bits = static_cast<std::uint64_t>(*integer) << shift;
+    if (integer_type->is_signed)
+    {
+        return static_cast<std::int64_t>(bits) >> shift;
+    }
+    return static_cast<std::int64_t>(bits >> shift);
+}
+
+std::optional<ConstantValue> EvaluateConversion(const ConstantValue& operand, const Type& source, const Type& target)
+{
+    if (auto floating = std::get_if<double>(&operand))
+    {
+        if (dynamic_cast<const FloatType*>(&target))
+        {
+            return WrapToType(*floating, target);
+        }
+
+        // values that are out of the range of the target type, including infinities and NaN, have no defined result
+        auto integer_type = dynamic_cast<const IntegerType*>(&target);
+        auto truncated = std::trunc(*floating);
+        if (!integer_type || !std::isfinite(truncated))
+        {
+            return std::nullopt;
+        }
+        if (!integer_type->is_signed)
+        {
+            if (truncated < 0.0 || truncated >= std::ldexp(1.0, integer_type->width))
+            {
+                return std::nullopt;
+            }
+            return static_cast<std::int64_t>(static_cast<std::uint64_t>(truncated));
+        }
+        auto bound = std::ldexp(1.0, integer_type->width - 1);
+        if (truncated < -bound || truncated >= bound)
+        {
+            return std::nullopt;
+        }
+        return static_cast<std::int64_t>(truncated);
+    }
+
+    auto ordinal = GetOrdinal(operand);
+    if (!ordinal)
+    {
+        return std::nullopt;
+    }
+    if (dynamic_cast<const FloatType*>(&target))
+    {
+        auto integer_type = dynamic_cast<const IntegerType*>(&source);
+        if (integer_type && !integer_type->is_signed)
+        {
+            return WrapToType(static_cast<double>(static_cast<std::uint64_t>(*ordinal)), target);
+        }
+        return WrapToType(static_cast<double>(*ordinal), target);
+    }
+    if (dynamic_cast<const IntegerType*>(&target))
+    {
+        return WrapToType(*ordinal, target);
+    }
+    if (dynamic_cast<const CharacterType*>(&target))
+    {
+        return static_cast<char8_t>(*ordinal);
+    }
+    return std::nullopt;
+}
+
+std::shared_ptr<Expression> MakeLiteral(const ConstantValue& value, std::shared_ptr<Type> type)
+{
+    std::shared_ptr<Expression> literal{nullptr};
+    if (std::holds_alternative<std::monostate>(value))
+    {
+        literal = std::make_shared<UnitLiteral>();
+    }
+    else if (auto boolean = std::get_if<bool>(&value))
+    {
+        literal = std::make_shared<BooleanLiteral>(*boolean);
+    }
+    else if (auto integer = std::get_if<std::int64_t>(&value))
+    {
+        literal = std::make_shared<IntegerLiteral>(std::get<std::int64_t>(WrapToType(*integer, *type)));
+    }
+    else if (auto floating = std::get_if<double>(&value))
+    {
+        literal = std::make_shared<FloatLiteral>(std::get<double>(WrapToType(*floating, *type)));
+    }
+    else if (auto character = std::get_if<char8_t>(&value))
+    {
+        literal = std::make_shared<CharacterLiteral>(*character);
+    }
+    else if (auto string = std::get_if<std::string>(&value))
+    {
+        literal = std::make_shared<StringLiteral>(*string);
+    }
+    else
+    {
+        return nullptr;
+    }
+    literal->type = type;
+    return literal;
+}
+
+std::optional<ConstantValue> EvaluateUnaryOp(UnaryOp::Overload overload, const ConstantValue& operand)
+{
+    switch (overload)
+    {
+        using Overload = UnaryOp::Overload;
+        case Overload::IntegerIdentity:
+        {
+            return operand;
+        }
+        case Overload::IntegerNegation:
+        {
+            auto value = static_cast<std::uint64_t>(std::get<std::int64_t>(operand));
+            return static_cast<std::int64_t>(-value);
+        }
+        case Overload::IntegerComplement:
+        {
+            return ~std::get<std::int64_t>(operand);
+        }
+        case Overload::FloatIdentity:
+        {
+            return operand;
+        }
+        case Overload::FloatNegation:
+        {
+            return -std::get<double>(operand);
+        }
+        case Overload::BooleanNegation:
+        {
+            return !std::get<bool>(operand);
+        }
+        case Overload::AddressOf:
+        case Overload::Dereferenciation:
+        {
+            return std::nullopt;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<ConstantValue> EvaluateBinaryOp(
+    BinaryOp::Overload overload, const ConstantValue& left, const ConstantValue& right, const Type& left_type
+)
+{
+    using Overload = BinaryOp::Overload;
+
+    if (std::holds_alternative<std::int64_t>(left) && std::holds_alternative<std::int64_t>(right))
+    {
+        const auto l = std::get<std::int64_t>(left);
+        const auto r = std::get<std::int64_t>(right);
+
+        // arithmetic wraps around like the generated instructions do
+        const auto wrap = [](std::uint64_t value) { return static_cast<std::int64_t>(value); };
+        const auto ul = static_cast<std::uint64_t>(l);
+        const auto ur = static_cast<std::uint64_t>(r);
+
+        // shift amounts are taken modulo the width of the shifted value
+        auto integer_type = dynamic_cast<const IntegerType*>(&left_type);
+        const auto shift = integer_type ? (ur & (integer_type->width - 1)) : std::uint64_t{0};
+
+        switch (overload)
+        {
+            case Overload::IntegerAddition:
+            {
+                return wrap(ul + ur);
+            }
+            case Overload::IntegerSubtraction:
+            {
+                return wrap(ul - ur);
+            }
+            case Overload::IntegerMultiplication:
+            {
+                return wrap(ul * ur);
+            }
+            case Overload::IntegerDivision:
+            {
+                if (r == 0 || (l == std::numeric_limits<std::int64_t>::min() && r == -1))
+                {
+                    return std::nullopt;
+                }
+                return l / r;
+            }
+            case Overload::IntegerRemainder:
+            {
+                if (r == 0 || (l == std::numeric_limits<std::int64_t>::min() && r == -1))
+                {
+                    return std::nullopt;
+                }
+                return l % r;
+            }
+            case Overload::IntegerBitwiseAnd:
+            {
+                return l & r;
+            }
+            case Overload::IntegerBitwiseOr:
+            {
+                return l | r;
+            }
+            case Overload::IntegerBitwiseXor:
+            {
+                return l ^ r;
+            }
+            case Overload::IntegerShiftLeft:
+            {
+                return wrap(ul << shift);
+            }
+            case Overload::IntegerShiftRight:
+            {
+                // signed values are sign-extended to 64 bits, so this is an arithmetic shift at every width
+                return l >> shift;
+            }
+            case Overload::UnsignedIntegerShiftRight:
+            {
+                // unsigned values are zero-extended to 64 bits, so this is a logical shift at every width
+                return wrap(ul >> shift);
+            }
+            case Overload::UnsignedIntegerDivision:
+            {
+                if (r == 0)
+                {
+                    return std::nullopt;
+                }
+                return wrap(ul / ur);
+            }
+            case Overload::UnsignedIntegerRemainder:
+            {
+                if (r == 0)
+                {
+                    return std::nullopt;
+                }
+                return wrap(ul % ur);
+            }
+            case Overload::IntegerEquality:
+            {
+                return l == r;
+            }
+            case Overload::IntegerInequality:
+            {
+                return l != r;
+            }
+            case Overload::IntegerLess:
+            {
+                return l < r;
+            }
+            case Overload::IntegerGreater:
+            {
+                return l > r;
+            }
+            case Overload::IntegerLessOrEquals:
+            {
+                return l <= r;
+            }
+            case Overload::IntegerGreaterOrEquals:
+            {
+                return l >= r;
+            }
+            case Overload::UnsignedIntegerLess:
+            {
+                return ul < ur;
+            }
+            case Overload::UnsignedIntegerGreater:
+            {
+                return ul > ur;
+            }
+            case Overload::UnsignedIntegerLessOrEquals:
+            {
+                return ul <= ur;
+            }
+            case Overload::UnsignedIntegerGreaterOrEquals:
+            {
+                return ul >= ur;
+            }
+            default:
+            {
+                return std::nullopt;
+            }
+        }
+    }
+
+    if (std::holds_alternative<double>(left) && std::holds_alternative<double>(right))
+    {
+        const auto l = std::get<double>(left);
+        const auto r = std::get<double>(right);
+
+        // IEEE semantics without fast-math assumptions; results of F32 operations are rounded by the caller
+        switch (overload)
+        {
+            case Overload::FloatAddition:
+            {
+                return l + r;
+            }
+            case Overload::FloatSubtraction:
+            {
+                return l - r;
+            }
+            case Overload::FloatMultiplication:
+            {
+                return l * r;
+            }
+            case Overload::FloatDivision:
+            {
+                return l / r;
+            }
+            case Overload::FloatRemainder:
+            {
+                return std::fmod(l, r);
+            }
+            case Overload::FloatEquality:
+            {
+                return l == r;
+            }
+            case Overload::FloatInequality:
+            {
+                return l != r;
+            }
+            case Overload::FloatLess:
+            {
+                return l < r;
+            }
+            case Overload::FloatGreater:
+            {
+                return l > r;
+            }
+            case Overload::FloatLessOrEquals:
+            {
+                return l <= r;
+            }
+            case Overload::FloatGreaterOrEquals:
+            {
+                return l >= r;
+            }
+            default:
+            {
+                return std::nullopt;
+            }
+        }
+    }
+
+    if (std::holds_alternative<bool>(left) && std::holds_alternative<bool>(right))
+    {
+        const auto l = std::get<bool>(left);
+        const auto r = std::get<bool>(right);
+
+        switch (overload)
+        {
+            case Overload::BooleanConjunction:
+            {
+                return l && r;
+            }
+            case Overload::BooleanDisjunction:
+            {
+                return l || r;
+            }
+            case Overload::BooleanEquality:
+            {
+                return l == r;
+            }
+            case Overload::BooleanInequality:
+            {
+                return l != r;
+            }
+            default:
+            {
+                return std::nullopt;
+            }
+        }
+    }
+
+    if (std::holds_alternative<EnumValue>(left) && std::holds_alternative<EnumValue>(right))
+    {
+        const auto l = std::get<EnumValue>(left).index;
+        const auto r = std::get<EnumValue>(right).index;
+
+        switch (overload)
+        {
+            case Overload::EnumMemberEquality:
+            {
+                return l == r;
+            }
+            case Overload::EnumMemberInequality:
+            {
+                return l != r;
+            }
+            default:
+            {
+                return std::nullopt;
+            }
+        }
+    }
+
+    if (std::holds_alternative<char8_t>(left))
+    {
+        const auto l = std::get<char8_t>(left);
+
+        switch (overload)
+        {
+            case Overload::CharacterAddition:
+            {
+                return static_cast<char8_t>(l + static_cast<char8_t>(std::get<std::int64_t>(right)));
+            }
+            case Overload::CharacterSubtraction:
+            {
+                return std::int64_t{l} - std::int64_t{std::get<char8_t>(right)};
+            }
+            case Overload::CharacterEquality:
+            {
+                return l == std::get<char8_t>(right);
+            }
+            case Overload::CharacterInequality:
+            {
+                return l != std::get<char8_t>(right);
+            }
+            default:
+            {
+                return std::nullopt;
+            }
+        }
+    }
+
+    return std::nullopt;
+}
+
+ConstEvaluator::ConstEvaluator(Module& module)
+    : module_{module}
+{
+}
+
+void ConstEvaluator::Run()
+{
+    for (const auto& declaration : module_.global_declarations)
+    {
+        if (!dynamic_pointer_cast<Function>(declaration->initializer))
+        {
+            global_constants_.insert({declaration->identifier.ToString(), declaration.get()});
+        }
+    }
+
+    for (auto& declaration : module_.global_declarations)
+    {
+        if (dynamic_pointer_cast<Function>(declaration->initializer))
+        {
+            continue;
+        }
+
+        auto value = EvaluateGlobal(declaration->identifier.ToString());
+        auto literal = MakeConstant(value, declaration->initializer->type);
+        if (!literal)
+        {
+            throw SemanticError(std::format(
+                "Value of global constant '{}' cannot be represented as a constant.", declaration->identifier.ToString()
+            ));
+        }
+        declaration->initializer = literal;
+    }
+}
+
+ConstantValue ConstEvaluator::EvaluateGlobal(const std::string& name)
+{
+    if (auto value = global_values_.find(name); value != global_values_.end())
+    {
+        return value->second;
+    }
+
+    auto declaration = global_constants_.find(name);
+    if (declaration == global_constants_.end())
+    {
+        // functions are the only other kind of global
+        auto global = std::ranges::find_if(
+            module_.global_declarations,
+            [&](const auto& declaration) { return declaration->identifier.ToString() == name; }
+        );
+        if (global == module_.global_declarations.end())
+        {
+            throw SemanticError(std::format("Global '{}' cannot be evaluated at compile time.", name));
+        }
+        return dynamic_cast<const Function*>((*global)->initializer.get());
+    }
+
+    if (globals_in_evaluation_.contains(name))
+    {
+        throw SemanticError(std::format("Initializer of global constant '{}' depends on itself.", name));
+    }
+
+    globals_in_evaluation_.insert(name);
+    auto frames_backup = std::move(frames_);
+    frames_.clear();
+
+    auto value = Evaluate(*declaration->second->initializer);
+
+    frames_ = std::move(frames_backup);
+    globals_in_evaluation_.erase(name);
+
+    global_values_.insert({name, value});
+    return value;
+}
+
+std::shared_ptr<Expression> ConstEvaluator::MakeEnumMember(const EnumValue& value) const
+{
+    Identifier name = value.type->identifier + *value.type->members->at(value.index);
+
+    auto member = std::make_shared<Variable>(name);
+    member->scope = module_.globals->IsVariableDeclared(name) ? module_.globals : module_.externals;
+    member->resolved_name = name;
+    member->type = value.type;
+    return member;
+}
+
+std::shared_ptr<Expression> ConstEvaluator::MakeConstant(const ConstantValue& value, std::shared_ptr<Type> type) const
+{
+    if (auto member = std::get_if<EnumValue>(&value))
+    {
+        return MakeEnumMember(*member);
+    }
+
+    auto array = std::get_if<ArrayValue>(&value);
+    if (!array)
+    {
+        return MakeLiteral(value, type);
+    }
+
+    auto array_type = dynamic_pointer_cast<ArrayType>(type);
+    auto elements = std::make_shared<ArgumentList>();
+    for (const auto& element : array->elements)
+    {
+        auto element_literal = MakeConstant(element, array_type->element_type);
+        if (!element_literal)
+        {
+            return nullptr;
+        }
+        elements->push_back(element_literal);
+    }
+
+    auto literal = std::make_shared<ArrayLiteral>(elements);
+    literal->type = type;
+    return literal;
+}
+
+ConstantValue ConstEvaluator::Evaluate(const Expression& expression)
+{
+    expression.Accept(*this);
+    return result_;
+}
+
+void ConstEvaluator::Step()
+{
+    if (++steps_ > kMaxSteps)
+    {
+        throw SemanticError(
+            std::format("Compile-time evaluation did not terminate within {} steps.", ConstEvaluator::kMaxSteps)
+        );
+    }
+}
+
+void ConstEvaluator::Visit(const StatementBlock& statement_block)
+{
+    for (const auto& statement : statement_block.statements)
+    {
+        statement->Accept(*this);
+        if (returning_)
+        {
+            return;
+        }
+    }
+}
+
+void ConstEvaluator::Visit(const Declaration& declaration)
+{
+    auto value = Evaluate(*declaration.initializer);
+    frames_.back()[{declaration.scope.get(), declaration.identifier.ToString()}] = value;
+}
+
+void ConstEvaluator::Visit(const TypeDeclaration&)
+{
+    throw SemanticError("Type declarations cannot be evaluated at compile time.");
+}
+
+void ConstEvaluator::Visit(const ExpressionStatement& expression_statement)
+{
+    Evaluate(*expression_statement.expression);
+}
+
+void ConstEvaluator::Visit(const ReturnStatement& return_statement)
+{
+    result_ = Evaluate(*return_statement.value);
+    returning_ = true;
+}
+
+void ConstEvaluator::Visit(const ConditionalStatement& conditional_statement)
+{
+    if (std::get<bool>(Evaluate(*conditional_statement.condition)))
+    {
+        conditional_statement.then_block->Accept(*this);
+    }
+    else if (conditional_statement.else_block)
+    {
+        conditional_statement.else_block->Accept(*this);
+    }
+}
+
+void ConstEvaluator::Visit(const MatchStatement& match_statement)
+{
+    auto subject = GetOrdinal(Evaluate(*match_statement.subject));
+    if (!subject)
+    {
+        throw SemanticError("Match statements over this type cannot be evaluated at compile time.");
+    }
+
+    if (auto match_case = FindMatchCase(match_statement, *subject))
+    {
+        match_case->body->Accept(*this);
+    }
+    else if (match_statement.else_block)
+    {
+        match_statement.else_block->Accept(*this);
+    }
+}
+
+void ConstEvaluator::Visit(const WhileLoop& while_loop)
+{
+    while (std::get<bool>(Evaluate(*while_loop.condition)))
+    {
+        Step();
+        while_loop.body->Accept(*this);
+        if (returning_)
+        {
+            return;
+        }
+    }
+}
+
+void ConstEvaluator::Visit(const ForLoop& for_loop)
+{
+    auto value = Evaluate(*for_loop.begin);
+    auto end = Evaluate(*for_loop.end);
+
+    const auto& type = *for_loop.scope->GetVariableType(for_loop.variable);
+    auto less = dynamic_cast<const IntegerType&>(type).is_signed ? BinaryOp::Overload::IntegerLess
+                                                                 : BinaryOp::Overload::UnsignedIntegerLess;
+    while (std::get<bool>(*EvaluateBinaryOp(less, value, end, type)))
+    {
+        Step();
+        frames_.back()[{for_loop.scope.get(), for_loop.variable}] = value;
+        for_loop.body->Accept(*this);
+        if (returning_)
+        {
+            return;
+        }
+        value = *EvaluateBinaryOp(BinaryOp::Overload::IntegerAddition, value, std::int64_t{1}, type);
+    }
+}
+
+void ConstEvaluator::Visit(const Deallocation&)
+{
+    throw SemanticError("Deallocations cannot be evaluated at compile time.");
+}
+
+void ConstEvaluator::Visit(const Assignment& assignment)
+{
+    auto target = dynamic_pointer_cast<Variable>(assignment.target);
+    if (!target || frames_.empty())
+    {
+        throw SemanticError("Only assignments to local variables can be evaluated at compile time.");
+    }
+
+    auto value = Evaluate(*assignment.expression);
+    auto local = frames_.back().find({target->scope.get(), target->resolved_name.ToString()});
+    if (local == frames_.back().end())
+    {
+        throw SemanticError(std::format(
+            "Assignment to '{}' cannot be evaluated at compile time.", target->resolved_name.ToString()
+        ));
+    }
+    local->second = value;
+    result_ = value;
+}
+
+void ConstEvaluator::Visit(const UnaryOp& unary_op)
+{
+    auto operand = Evaluate(*unary_op.operand);
+    auto value = EvaluateUnaryOp(unary_op.overload, operand);
+    if (!value)
+    {
+        throw SemanticError("Unary operation cannot be evaluated at compile time.");
+    }
+    result_ = WrapToType(*value, *unary_op.type);
+}
+
+void ConstEvaluator::Visit(const BinaryOp& binary_op)
+{
+    auto left = Evaluate(*binary_op.left);
+    auto right = Evaluate(*binary_op.right);
+    auto value = EvaluateBinaryOp(binary_op.overload, left, right, *binary_op.left->type);
+    if (!value)
+    {
+        throw SemanticError("Binary operation cannot be evaluated at compile time (e.g. division by zero).");
+    }
+    result_ = WrapToType(*value, *binary_op.type);
+}
+
+void ConstEvaluator::Visit(const Variable& variable)
+{
+    if (!frames_.empty())
+    {
+        auto local = frames_.back().find({variable.scope.get(), variable.resolved_name.ToString()});
+        if (local != frames_.back().end())
+        {
+            result_ = local->second;
+            return;
+        }
+    }
+
+    auto enum_type = dynamic_pointer_cast<EnumType>(variable.type);
+    auto index = enum_type ? enum_type->GetMemberIndex(variable.resolved_name) : std::nullopt;
+    if (index && (variable.scope == module_.globals || variable.scope == module_.externals))
+    {
+        result_ = EnumValue{enum_type, *index};
+        return;
+    }
+
+    if (variable.scope != module_.globals)
+    {
+        throw SemanticError(std::format(
+            "Variable '{}' cannot be evaluated at compile time.", variable.resolved_name.ToString()
+        ));
+    }
+    result_ = EvaluateGlobal(variable.resolved_name.ToString());
+}
+
+void ConstEvaluator::Visit(const MemberAccessor& member_accessor)
+{
+    auto length = GetFixedLength(*member_accessor.dereferenced_object->type);
+    if (member_accessor.builtin_member != MemberAccessor::BuiltinMember::Length || !length)
+    {
+        throw SemanticError("Member accesses cannot be evaluated at compile time.");
+    }
+    result_ = static_cast<std::int64_t>(*length);
+}
+
+void ConstEvaluator::Visit(const Call& call)
+{
+    auto callee = Evaluate(*call.function);
+    auto function = std::get_if<const Function*>(&callee);
+    if (!function || !*function || !(*function)->is_const)
+    {
+        throw SemanticError("Only calls of 'const fn' functions can be evaluated at compile time.");
+    }
+
+    std::map<VariableKey, ConstantValue> frame{};
+    for (auto index : std::views::iota(std::size_t{0}, call.arguments->size()))
+    {
+        auto argument = Evaluate(*call.arguments->at(index));
+        frame[{(*function)->locals.get(), (*function)->parameters->at(index)->name}] = argument;
+    }
+
+    if (frames_.size() >= ConstEvaluator::kMaxCallDepth)
+    {
+        throw SemanticError(
+            std::format("Compile-time evaluation exceeded the call depth of {}.", ConstEvaluator::kMaxCallDepth)
+        );
+    }
+    Step();
+
+    frames_.push_back(std::move(frame));
+    (*function)->body->Accept(*this);
+    frames_.pop_back();
+
+    returning_ = false;
+}
+
+void ConstEvaluator::Visit(const UnitLiteral&)
+{
+    result_ = std::monostate{};
+}
+
+void ConstEvaluator::Visit(const BooleanLiteral& literal)
+{
+    result_ = literal.value;
+}
+
+void ConstEvaluator::Visit(const IntegerLiteral& literal)
+{
+    result_ = literal.value;
+}
+
+void ConstEvaluator::Visit(const FloatLiteral& literal)
+{
+    result_ = literal.value;
+}
+
+void ConstEvaluator::Visit(const CharacterLiteral& literal)
+{
+    result_ = literal.value;
+}
+
+void ConstEvaluator::Visit(const StringLiteral& literal)
+{
+    result_ = literal.value;
+}
+
+void ConstEvaluator::Visit(const Function&)
+{
+    throw SemanticError("Function literals cannot be evaluated at compile time.");
+}
+
+void ConstEvaluator::Visit(const Initializer&)
+{
+    throw SemanticError("Initializers cannot be evaluated at compile time.");
+}
+
+void ConstEvaluator::Visit(const Allocation&)
+{
+    throw SemanticError("Allocations cannot be evaluated at compile time.");
+}
+
+void ConstEvaluator::Visit(const Conversion& conversion)
+{
+    auto operand = Evaluate(*conversion.operand);
+    auto value = EvaluateConversion(operand, *conversion.operand->type, *conversion.type);
+    if (!value)
+    {
+        throw SemanticError("Conversion cannot be evaluated at compile time.");
+    }
+    result_ = *value;
+}
+
+void ConstEvaluator::Visit(const ElementAccessor& element_accessor)
+{
+    auto object = Evaluate(*element_accessor.dereferenced_object);
+    auto index = std::get<std::int64_t>(Evaluate(*element_accessor.index));
+
+    auto array = std::get_if<ArrayValue>(&object);
+    if (!array)
+    {
+        throw SemanticError("Elements of slices cannot be evaluated at compile time.");
+    }
+    auto& elements = array->elements;
+    if (index < 0 || static_cast<std::size_t>(index) >= elements.size())
+    {
+        throw SemanticError(std::format(
+            "Index {} is out of range for array of type '{}'.",
+            index,
+            element_accessor.dereferenced_object_type->ToString()
+        ));
+    }
+    result_ = elements.at(static_cast<std::size_t>(index));
+}
+
+void ConstEvaluator::Visit(const ArrayLiteral& array_literal)
+{
+    ArrayValue array{};
+    for (const auto& element : *array_literal.elements)
+    {
+        array.elements.push_back(Evaluate(*element));
+    }
+
+    if (array_literal.repetitions)
+    {
+        array.elements.resize(*array_literal.repetitions, array.elements.front());
+    }
+    result_ = std::move(array);
+}
+
+void ConstEvaluator::Visit(const Slicing&)
+{
+    throw SemanticError("Slicings cannot be evaluated at compile time.");
+}
+
+}  // namespace l0::detail
@@ -0,0 +1,143 @@
+#ifndef L0_SEMANTICS_CONST_EVALUATOR_H
+#define L0_SEMANTICS_CONST_EVALUATOR_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "l0/ast/expression.h"
+#include "l0/ast/module.h"
+#include "l0/ast/scope.h"
+#include "l0/ast/statement.h"
+
+namespace l0::detail
+{
+
+struct EnumValue
+{
+    std::shared_ptr<EnumType> type;
+    std::size_t index;
+
+    bool operator==(const EnumValue&) const = default;
+};
+
+struct ArrayValue;
+
+using ConstantValue = std::
+    variant<std::monostate, bool, std::int64_t, double, char8_t, std::string, const Function*, EnumValue, ArrayValue>;
+
+struct ArrayValue
+{
+    std::vector<ConstantValue> elements;
+
+    bool operator==(const ArrayValue&) const = default;
+};
+
+// Values of boolean, integer, floating-point and character literals
+std::optional<ConstantValue> GetLiteralValue(const Expression& expression);
+std::shared_ptr<Expression> MakeLiteral(const ConstantValue& value, std::shared_ptr<Type> type);
+
+// Integer values wrapped around into the range of the given type, and floating-point values rounded to its precision,
+// as the generated code does; other values are returned unchanged
+ConstantValue WrapToType(const ConstantValue& value, const Type& type);
+
+// Explicit conversion of integers, characters, booleans and enum members to integers or characters, and between
+// integers and floating-point numbers; empty if the result is undefined
+std::optional<ConstantValue> EvaluateConversion(const ConstantValue& operand, const Type& source, const Type& target);
+
+// Booleans, integers, characters and enum members as a single integer, as used for the bounds of match patterns
+std::optional<std::int64_t> GetOrdinal(const ConstantValue& value);
+
+// The case of a match statement taken for the given subject; nullptr if the else block is taken
+const MatchCase* FindMatchCase(const MatchStatement& match_statement, std::int64_t subject);
+
+// Evaluate builtin operators with the semantics of the generated code; empty if the result is undefined or the operator
+// is not applicable to constants. Binary operators also take the type of the left operand, which determines e.g. the
+// range of shift amounts.
+std::optional<ConstantValue> EvaluateUnaryOp(UnaryOp::Overload overload, const ConstantValue& operand);
+std::optional<ConstantValue> EvaluateBinaryOp(
+    BinaryOp::Overload overload, const ConstantValue& left, const ConstantValue& right, const Type& left_type
+);
+
+/// @brief Evaluates the initializers of global constants at compile time and replaces them by literals.
+///
+/// Initializers may consist of literals, array literals, builtin operators, other global constants and calls to
+/// `const fn` functions of the same module. The bodies of such functions are interpreted over the typed AST; they may
+/// declare, assign and return local variables, and use conditionals and loops, but must not allocate, dereference or
+/// call non-const functions.
+class ConstEvaluator : private IConstExpressionVisitor, private IConstStatementVisitor
+{
+   public:
+    ConstEvaluator(Module& module);
+    void Run();
+
+   private:
+    struct VariableKey
+    {
+        const Scope* scope;
+        std::string name;
+
+        auto operator<=>(const VariableKey&) const = default;
+    };
+
+    static constexpr std::size_t kMaxSteps = 10'000'000;
+    static constexpr std::size_t kMaxCallDepth = 1'000;
+
+    Module& module_;
+
+    std::map<std::string, const Declaration*> global_constants_{};
+    std::map<std::string, ConstantValue> global_values_{};
+    std::set<std::string> globals_in_evaluation_{};
+
+    std::vector<std::map<VariableKey, ConstantValue>> frames_{};
+    std::size_t steps_{0};
+
+    ConstantValue result_{};
+    bool returning_{false};
+
+    ConstantValue EvaluateGlobal(const std::string& name);
+    std::shared_ptr<Expression> MakeEnumMember(const EnumValue& value) const;
+    std::shared_ptr<Expression> MakeConstant(const ConstantValue& value, std::shared_ptr<Type> type) const;
+    ConstantValue Evaluate(const Expression& expression);
+    void Step();
+
+    void Visit(const StatementBlock& statement_block) override;
+    void Visit(const Declaration& declaration) override;
+    void Visit(const TypeDeclaration& type_declaration) override;
+    void Visit(const ExpressionStatement& expression_statement) override;
+    void Visit(const ReturnStatement& return_statement) override;
+    void Visit(const ConditionalStatement& conditional_statement) override;
+    void Visit(const MatchStatement& match_statement) override;
+    void Visit(const WhileLoop& while_loop) override;
+    void Visit(const ForLoop& for_loop) override;
+    void Visit(const Deallocation& deallocation) override;
+
+    void Visit(const Assignment& assignment) override;
+    void Visit(const UnaryOp& unary_op) override;
+    void Visit(const BinaryOp& binary_op) override;
+    void Visit(const Variable& variable) override;
+    void Visit(const MemberAccessor& member_accessor) override;
+    void Visit(const Call& call) override;
+    void Visit(const UnitLiteral& literal) override;
+    void Visit(const BooleanLiteral& literal) override;
+    void Visit(const IntegerLiteral& literal) override;
+    void Visit(const FloatLiteral& literal) override;
+    void Visit(const CharacterLiteral& literal) override;
+    void Visit(const StringLiteral& literal) override;
+    void Visit(const Function& function) override;
+    void Visit(const Initializer& initializer) override;
+    void Visit(const Allocation& allocation) override;
+    void Visit(const Conversion& conversion) override;
+    void Visit(const ElementAccessor& element_accessor) override;
+    void Visit(const ArrayLiteral& array_literal) override;
+    void Visit(const Slicing& slicing) override;
+};
+
+}  // namespace l0::detail
+
+#endif
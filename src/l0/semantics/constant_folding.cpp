@@ -0,0 +1,386 @@
+#include "l0/semantics/constant_folding.h"
+
+#include "l0/semantics/const_evaluator.h"
+
+namespace l0::detail
+{
+
+ConstantFolding::ConstantFolding(Module& module)
+    : module_{module}
+{
+}
+
+void ConstantFolding::Run()
+{
+    for (auto& declaration : module_.global_declarations)
+    {
+        if (!dynamic_pointer_cast<Function>(declaration->initializer))
+        {
+            declaration->Accept(*this);
+        }
+    }
+
+    for (auto callable : module_.callables)
+    {
+        callable->Accept(*this);
+    }
+}
+
+void ConstantFolding::Fold(std::shared_ptr<Expression>& expression)
+{
+    expression->Accept(*this);
+    if (folded_expression_)
+    {
+        expression = folded_expression_;
+        folded_expression_ = nullptr;
+    }
+}
+
+void ConstantFolding::Visit(StatementBlock& statement_block)
+{
+    auto& statements = statement_block.statements;
+
+    bool block_returns{false};
+    for (auto it = statements.begin(); it != statements.end();)
+    {
+        (*it)->Accept(*this);
+
+        if (remove_statement_)
+        {
+            remove_statement_ = false;
+            it = statements.erase(it);
+            continue;
+        }
+        if (replacement_statement_)
+        {
+            *it = replacement_statement_;
+            replacement_statement_ = nullptr;
+        }
+
+        if (statement_returns_)
+        {
+            // a removed branch may have been the only one not returning; the remainder of the block is dead
+            block_returns = true;
+            statements.erase(it + 1, statements.end());
+            break;
+        }
+        ++it;
+    }
+
+    statement_returns_ = block_returns;
+}
+
+void ConstantFolding::Visit(Declaration& declaration)
+{
+    Fold(declaration.initializer);
+
+    auto type = declaration.scope->GetVariableType(declaration.identifier);
+    if (type->mutability == TypeQualifier::Constant && GetLiteralValue(*declaration.initializer))
+    {
+        constants_[{declaration.scope.get(), declaration.identifier.ToString()}] = declaration.initializer;
+    }
+
+    statement_returns_ = false;
+}
+
+void ConstantFolding::Visit(TypeDeclaration&)
+{
+    statement_returns_ = false;
+}
+
+void ConstantFolding::Visit(ExpressionStatement& expression_statement)
+{
+    Fold(expression_statement.expression);
+    statement_returns_ = false;
+}
+
+void ConstantFolding::Visit(ReturnStatement& return_statement)
+{
+    Fold(return_statement.value);
+    statement_returns_ = true;
+}
+
+void ConstantFolding::Visit(ConditionalStatement& conditional_statement)
+{
+    Fold(conditional_statement.condition);
+
+    conditional_statement.then_block->Accept(*this);
+    conditional_statement.then_block_returns = statement_returns_;
+
+    if (conditional_statement.else_block)
+    {
+        conditional_statement.else_block->Accept(*this);
+        conditional_statement.else_block_returns = statement_returns_;
+    }
+
+    auto condition = dynamic_pointer_cast<BooleanLiteral>(conditional_statement.condition);
+    if (!condition)
+    {
+        statement_returns_ = conditional_statement.then_block_returns && conditional_statement.else_block_returns;
+    }
+    else if (condition->value)
+    {
+        replacement_statement_ = conditional_statement.then_block;
+        statement_returns_ = conditional_statement.then_block_returns;
+    }
+    else if (conditional_statement.else_block)
+    {
+        replacement_statement_ = conditional_statement.else_block;
+        statement_returns_ = conditional_statement.else_block_returns;
+    }
+    else
+    {
+        remove_statement_ = true;
+        statement_returns_ = false;
+    }
+}
+
+void ConstantFolding::Visit(MatchStatement& match_statement)
+{
+    Fold(match_statement.subject);
+
+    bool all_cases_return{true};
+    for (auto& match_case : *match_statement.cases)
+    {
+        match_case->body->Accept(*this);
+        match_case->body_returns = statement_returns_;
+        all_cases_return = all_cases_return && match_case->body_returns;
+    }
+    if (match_statement.else_block)
+    {
+        match_statement.else_block->Accept(*this);
+        match_statement.else_block_returns = statement_returns_;
+        all_cases_return = all_cases_return && match_statement.else_block_returns;
+    }
+    statement_returns_ = all_cases_return;
+
+    auto subject = GetLiteralValue(*match_statement.subject);
+    auto ordinal = subject ? GetOrdinal(*subject) : std::nullopt;
+    if (!ordinal)
+    {
+        return;
+    }
+
+    // the typechecker has ensured that there is an else block if no case matches
+    if (auto match_case = FindMatchCase(match_statement, *ordinal))
+    {
+        replacement_statement_ = match_case->body;
+        statement_returns_ = match_case->body_returns;
+    }
+    else
+    {
+        replacement_statement_ = match_statement.else_block;
+        statement_returns_ = match_statement.else_block_returns;
+    }
+}
+
+void ConstantFolding::Visit(WhileLoop& while_loop)
+{
+    Fold(while_loop.condition);
+    while_loop.body->Accept(*this);
+
+    auto condition = dynamic_pointer_cast<BooleanLiteral>(while_loop.condition);
+    remove_statement_ = condition && !condition->value;
+    statement_returns_ = false;
+}
+
+void ConstantFolding::Visit(ForLoop& for_loop)
+{
+    Fold(for_loop.begin);
+    Fold(for_loop.end);
+    for_loop.body->Accept(*this);
+
+    // loops over empty ranges of literals are removed
+    auto begin = GetLiteralValue(*for_loop.begin);
+    auto end = GetLiteralValue(*for_loop.end);
+    if (begin && end)
+    {
+        const auto& type = *for_loop.scope->GetVariableType(for_loop.variable);
+        auto less = dynamic_cast<const IntegerType&>(type).is_signed ? BinaryOp::Overload::IntegerLess
+                                                                     : BinaryOp::Overload::UnsignedIntegerLess;
+        remove_statement_ = !std::get<bool>(*EvaluateBinaryOp(less, *begin, *end, type));
+    }
+    statement_returns_ = false;
+}
+
+void ConstantFolding::Visit(Deallocation& deallocation)
+{
+    Fold(deallocation.reference);
+    statement_returns_ = false;
+}
+
+void ConstantFolding::Visit(Assignment& assignment)
+{
+    Fold(assignment.target);
+    Fold(assignment.expression);
+}
+
+void ConstantFolding::Visit(UnaryOp& unary_op)
+{
+    if (unary_op.overload == UnaryOp::Overload::AddressOf)
+    {
+        // the operand must keep its address
+        unary_op.operand->Accept(*this);
+        folded_expression_ = nullptr;
+        return;
+    }
+
+    Fold(unary_op.operand);
+    FoldUnaryOp(unary_op);
+}
+
+void ConstantFolding::FoldUnaryOp(UnaryOp& unary_op)
+{
+    auto operand = GetLiteralValue(*unary_op.operand);
+    if (!operand)
+    {
+        return;
+    }
+
+    if (auto value = EvaluateUnaryOp(unary_op.overload, *operand))
+    {
+        folded_expression_ = MakeLiteral(*value, unary_op.type);
+    }
+}
+
+void ConstantFolding::Visit(BinaryOp& binary_op)
+{
+    Fold(binary_op.left);
+    Fold(binary_op.right);
+    FoldBinaryOp(binary_op);
+}
+
+void ConstantFolding::FoldBinaryOp(BinaryOp& binary_op)
+{
+    auto left = GetLiteralValue(*binary_op.left);
+    auto right = GetLiteralValue(*binary_op.right);
+    if (!left || !right)
+    {
+        return;
+    }
+
+    if (auto value = EvaluateBinaryOp(binary_op.overload, *left, *right, *binary_op.left->type))
+    {
+        folded_expression_ = MakeLiteral(*value, binary_op.type);
+    }
+}
+
+void ConstantFolding::Visit(Variable& variable)
+{
+    auto constant = constants_.find({variable.scope.get(), variable.resolved_name.ToString()});
+    if (constant != constants_.end())
+    {
+        folded_expression_ = constant->second;
+    }
+}
+
+void ConstantFolding::Visit(MemberAccessor& member_accessor)
+{
+    // the typechecker has derived further nodes from the object, so it is simplified but not replaced
+    member_accessor.object->Accept(*this);
+    folded_expression_ = nullptr;
+
+    // the length of an array or vector is part of its type; the object is dropped, so it must be free of side effects
+    auto length = GetFixedLength(*member_accessor.dereferenced_object->type);
+    if (member_accessor.builtin_member == MemberAccessor::BuiltinMember::Length && length
+        && dynamic_pointer_cast<Variable>(member_accessor.object))
+    {
+        folded_expression_ = MakeLiteral(static_cast<std::int64_t>(*length), member_accessor.type);
+    }
+}
+
+void ConstantFolding::Visit(Call& call)
+{
+    call.function->Accept(*this);
+    folded_expression_ = nullptr;
+
+    for (auto& argument : *call.arguments)
+    {
+        Fold(argument);
+    }
+}
+
+void ConstantFolding::Visit(UnitLiteral&) {}
+void ConstantFolding::Visit(BooleanLiteral&) {}
+void ConstantFolding::Visit(IntegerLiteral&) {}
+void ConstantFolding::Visit(FloatLiteral&) {}
+void ConstantFolding::Visit(CharacterLiteral&) {}
+void ConstantFolding::Visit(StringLiteral&) {}
+
+void ConstantFolding::Visit(Function& function)
+{
+    function.body->Accept(*this);
+    statement_returns_ = false;
+}
+
+void ConstantFolding::Visit(Initializer& initializer)
+{
+    for (auto& member_initializer : *initializer.member_initializers)
+    {
+        Fold(member_initializer->value);
+    }
+}
+
+void ConstantFolding::Visit(Allocation& allocation)
+{
+    if (allocation.size)
+    {
+        Fold(allocation.size);
+    }
+    if (allocation.member_initializers)
+    {
+        for (auto& member_initializer : *allocation.member_initializers)
+        {
+            Fold(member_initializer->value);
+        }
+    }
+}
+
+void ConstantFolding::Visit(Conversion& conversion)
+{
+    Fold(conversion.operand);
+
+    auto operand = GetLiteralValue(*conversion.operand);
+    if (!operand)
+    {
+        return;
+    }
+
+    if (auto value = EvaluateConversion(*operand, *conversion.operand->type, *conversion.type))
+    {
+        folded_expression_ = MakeLiteral(*value, conversion.type);
+    }
+}
+
+void ConstantFolding::Visit(ElementAccessor& element_accessor)
+{
+    // like for member accessors, the object is simplified but not replaced
+    element_accessor.object->Accept(*this);
+    folded_expression_ = nullptr;
+    Fold(element_accessor.index);
+}
+
+void ConstantFolding::Visit(ArrayLiteral& array_literal)
+{
+    for (auto& element : *array_literal.elements)
+    {
+        Fold(element);
+    }
+}
+
+void ConstantFolding::Visit(Slicing& slicing)
+{
+    slicing.object->Accept(*this);
+    folded_expression_ = nullptr;
+
+    if (slicing.lower)
+    {
+        Fold(slicing.lower);
+    }
+    if (slicing.upper)
+    {
+        Fold(slicing.upper);
+    }
+}
+
+}  // namespace l0::detail
@@ -0,0 +1,85 @@
+#ifndef L0_SEMANTICS_CONSTANT_FOLDING_H
+#define L0_SEMANTICS_CONSTANT_FOLDING_H
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "l0/ast/expression.h"
+#include "l0/ast/module.h"
+#include "l0/ast/scope.h"
+#include "l0/ast/statement.h"
+
+namespace l0::detail
+{
+
+/// @brief Simplifies the AST before IR generation.
+///
+/// Unary and binary operations and conversions over boolean, integer, floating-point and character literals are
+/// replaced by their result, with the same semantics as the generated code (e.g. wrapping integer arithmetic).
+/// Immutable variables initialized with a literal are replaced by that literal. Conditional statements and while loops
+/// with constant conditions are replaced by the branch that is taken, or removed altogether. For loops over empty ranges
+/// are removed as well.
+class ConstantFolding : private IStatementVisitor, private IExpressionVisitor
+{
+   public:
+    ConstantFolding(Module& module);
+    void Run();
+
+   private:
+    struct VariableKey
+    {
+        const Scope* scope;
+        std::string name;
+
+        auto operator<=>(const VariableKey&) const = default;
+    };
+
+    Module& module_;
+
+    std::map<VariableKey, std::shared_ptr<Expression>> constants_{};
+
+    std::shared_ptr<Expression> folded_expression_{nullptr};
+    std::shared_ptr<Statement> replacement_statement_{nullptr};
+    bool remove_statement_{false};
+    bool statement_returns_{false};
+
+    void Fold(std::shared_ptr<Expression>& expression);
+    void FoldUnaryOp(UnaryOp& unary_op);
+    void FoldBinaryOp(BinaryOp& binary_op);
+
+    void Visit(StatementBlock& statement_block) override;
+    void Visit(Declaration& declaration) override;
+    void Visit(TypeDeclaration& type_declaration) override;
+    void Visit(ExpressionStatement& expression_statement) override;
+    void Visit(ReturnStatement& return_statement) override;
+    void Visit(ConditionalStatement& conditional_statement) override;
+    void Visit(MatchStatement& match_statement) override;
+    void Visit(WhileLoop& while_loop) override;
+    void Visit(ForLoop& for_loop) override;
+    void Visit(Deallocation& deallocation) override;
+
+    void Visit(Assignment& assignment) override;
+    void Visit(UnaryOp& unary_op) override;
+    void Visit(BinaryOp& binary_op) override;
+    void Visit(Variable& variable) override;
+    void Visit(MemberAccessor& member_accessor) override;
+    void Visit(Call& call) override;
+    void Visit(UnitLiteral& literal) override;
+    void Visit(BooleanLiteral& literal) override;
+    void Visit(IntegerLiteral& literal) override;
+    void Visit(FloatLiteral& literal) override;
+    void Visit(CharacterLiteral& literal) override;
+    void Visit(StringLiteral& literal) override;
+    void Visit(Function& function) override;
+    void Visit(Initializer& initializer) override;
+    void Visit(Allocation& allocation) override;
+    void Visit(Conversion& conversion) override;
+    void Visit(ElementAccessor& element_accessor) override;
+    void Visit(ArrayLiteral& array_literal) override;
+    void Visit(Slicing& slicing) override;
+};
+
+}  // namespace l0::detail
+
+#endif
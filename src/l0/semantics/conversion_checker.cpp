@@ -81,9 +81,16 @@ void ConversionChecker::Visit(const BooleanType&)
     result_ = bool{dynamic_pointer_cast<BooleanType>(value_)};
 }
 
-void ConversionChecker::Visit(const IntegerType&)
+void ConversionChecker::Visit(const IntegerType& integer_type)
 {
-    result_ = dynamic_pointer_cast<IntegerType>(value_) != nullptr;
+    auto value_as_integer_type = dynamic_pointer_cast<IntegerType>(value_);
+    result_ = value_as_integer_type && (integer_type == *value_as_integer_type);
+}
+
+void ConversionChecker::Visit(const FloatType& float_type)
+{
+    auto value_as_float_type = dynamic_pointer_cast<FloatType>(value_);
+    result_ = value_as_float_type && (float_type == *value_as_float_type);
 }
 
 void ConversionChecker::Visit(const CharacterType&)
@@ -91,6 +98,47 @@ void ConversionChecker::Visit(const CharacterType&)
     result_ = dynamic_pointer_cast<CharacterType>(value_) != nullptr;
 }
 
+void ConversionChecker::Visit(const ArrayType& array_type)
+{
+    auto value_as_array_type = dynamic_pointer_cast<ArrayType>(value_);
+    if (!value_as_array_type || array_type.length != value_as_array_type->length)
+    {
+        result_ = false;
+        return;
+    }
+
+    value_ = value_as_array_type->element_type;
+    array_type.element_type->Accept(*this);
+    // leave result_ as is
+}
+
+void ConversionChecker::Visit(const SliceType& slice_type)
+{
+    auto value_as_slice_type = dynamic_pointer_cast<SliceType>(value_);
+    if (!value_as_slice_type)
+    {
+        result_ = false;
+        return;
+    }
+
+    if (slice_type.element_type->mutability == TypeQualifier::Mutable
+        && value_as_slice_type->element_type->mutability == TypeQualifier::Constant)
+    {
+        result_ = false;
+        return;
+    }
+
+    value_ = value_as_slice_type->element_type;
+    slice_type.element_type->Accept(*this);
+    // leave result_ as is
+}
+
+void ConversionChecker::Visit(const VectorType& vector_type)
+{
+    auto value_as_vector_type = dynamic_pointer_cast<VectorType>(value_);
+    result_ = value_as_vector_type && (vector_type == *value_as_vector_type);
+}
+
 void ConversionChecker::Visit(const FunctionType& function_type)
 {
     auto value_as_function_type = dynamic_pointer_cast<FunctionType>(value_);
@@ -26,7 +26,11 @@ class ConversionChecker : IConstTypeVisitor
     void Visit(const UnitType& unit_type) override;
     void Visit(const BooleanType& boolean_type) override;
     void Visit(const IntegerType& integer_type) override;
+    void Visit(const FloatType& float_type) override;
     void Visit(const CharacterType& character_type) override;
+    void Visit(const ArrayType& array_type) override;
+    void Visit(const SliceType& slice_type) override;
+    void Visit(const VectorType& vector_type) override;
     void Visit(const FunctionType& function_type) override;
     void Visit(const StructType& struct_type) override;
     void Visit(const EnumType& enum_type) override;
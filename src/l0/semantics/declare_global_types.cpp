@@ -17,11 +17,12 @@ void DeclareGlobaType(Module& module, const TypeDeclaration& type_declaration)
 {
     module.globals->DeclareType(type_declaration.identifier);
 
-    if (dynamic_pointer_cast<StructExpression>(type_declaration.definition))
+    if (auto struct_expression = dynamic_pointer_cast<StructExpression>(type_declaration.definition))
     {
         auto type = std::make_shared<StructType>(
             type_declaration.identifier, std::make_shared<StructMemberList>(), TypeQualifier::Constant
         );
+        type->is_packed = struct_expression->is_packed;
         type_declaration.type = type;
         module.globals->DefineType(type_declaration.identifier, type);
     }
@@ -23,11 +23,10 @@ void DeclareGlobalVariable(Module& module, const Declaration& declaration, TypeR
         );
     }
 
-    auto function = dynamic_pointer_cast<Function>(declaration.initializer);
-    if (!function)
+    if (!declaration.initializer)
     {
         throw SemanticError(
-            std::format("Initializer of global variable must be a function.", declaration.identifier.ToString())
+            std::format("Global variable '{}' must be initialized.", declaration.identifier.ToString())
         );
     }
 
@@ -48,6 +47,13 @@ void DeclareGlobalVariable(Module& module, const Declaration& declaration, TypeR
 
     declaration.scope = module.globals;
 
+    // other initializers are evaluated at compile time
+    auto function = dynamic_pointer_cast<Function>(declaration.initializer);
+    if (!function)
+    {
+        return;
+    }
+
     function->global_name =
         declaration.identifier == "main" ? "main" : std::format("__fn__{}", declaration.identifier.ToString());
     module.callables.push_back(function);
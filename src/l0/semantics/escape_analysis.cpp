@@ -0,0 +1,324 @@
+#include "l0/semantics/escape_analysis.h"
+
+namespace l0::detail
+{
+
+EscapeAnalysis::EscapeAnalysis(const Module& module)
+    : module_{module}
+{
+}
+
+void EscapeAnalysis::Run()
+{
+    for (const auto& declaration : module_.global_declarations)
+    {
+        if (auto function = dynamic_pointer_cast<Function>(declaration->initializer))
+        {
+            global_functions_.insert({declaration->identifier.ToString(), function.get()});
+        }
+    }
+    for (const auto& type_declaration : module_.global_type_declarations)
+    {
+        auto struct_type = dynamic_pointer_cast<StructType>(type_declaration->type);
+        if (!struct_type)
+        {
+            continue;
+        }
+        for (const auto& member : *struct_type->members)
+        {
+            auto function = dynamic_pointer_cast<Function>(member->default_initializer);
+            if (function && member->default_initializer_global_name)
+            {
+                global_functions_.insert({*member->default_initializer_global_name, function.get()});
+            }
+        }
+    }
+
+    for (auto callable : module_.callables)
+    {
+        VisitEscaping(*callable);
+    }
+
+    PropagateEscapes();
+
+    for (const auto& [function, target] : closures_)
+    {
+        function->context_may_escape = !target || escaping_variables_.contains(*target);
+    }
+}
+
+void EscapeAnalysis::Visit(const StatementBlock& statement_block)
+{
+    for (auto statement : statement_block.statements)
+    {
+        statement->Accept(*this);
+    }
+}
+
+void EscapeAnalysis::Visit(const Declaration& declaration)
+{
+    VisitFlowingInto(*declaration.initializer, {declaration.scope.get(), declaration.identifier.ToString()});
+}
+
+void EscapeAnalysis::Visit(const TypeDeclaration&) {}
+
+void EscapeAnalysis::Visit(const ExpressionStatement& expression_statement)
+{
+    VisitEscaping(*expression_statement.expression);
+}
+
+void EscapeAnalysis::Visit(const ReturnStatement& return_statement)
+{
+    VisitEscaping(*return_statement.value);
+}
+
+void EscapeAnalysis::Visit(const ConditionalStatement& conditional_statement)
+{
+    VisitEscaping(*conditional_statement.condition);
+    conditional_statement.then_block->Accept(*this);
+    if (conditional_statement.else_block)
+    {
+        conditional_statement.else_block->Accept(*this);
+    }
+}
+
+void EscapeAnalysis::Visit(const MatchStatement& match_statement)
+{
+    VisitEscaping(*match_statement.subject);
+    for (const auto& match_case : *match_statement.cases)
+    {
+        match_case->body->Accept(*this);
+    }
+    if (match_statement.else_block)
+    {
+        match_statement.else_block->Accept(*this);
+    }
+}
+
+void EscapeAnalysis::Visit(const WhileLoop& while_loop)
+{
+    VisitEscaping(*while_loop.condition);
+    while_loop.body->Accept(*this);
+}
+
+void EscapeAnalysis::Visit(const ForLoop& for_loop)
+{
+    VisitEscaping(*for_loop.begin);
+    VisitEscaping(*for_loop.end);
+    for_loop.body->Accept(*this);
+}
+
+void EscapeAnalysis::Visit(const Deallocation& deallocation)
+{
+    VisitEscaping(*deallocation.reference);
+}
+
+void EscapeAnalysis::Visit(const Assignment& assignment)
+{
+    // Overwriting a variable does not leak the value it held before.
+    if (!dynamic_pointer_cast<Variable>(assignment.target))
+    {
+        VisitEscaping(*assignment.target);
+    }
+    VisitEscaping(*assignment.expression);
+}
+
+void EscapeAnalysis::Visit(const UnaryOp& unary_op)
+{
+    VisitEscaping(*unary_op.operand);
+}
+
+void EscapeAnalysis::Visit(const BinaryOp& binary_op)
+{
+    VisitEscaping(*binary_op.left);
+    VisitEscaping(*binary_op.right);
+}
+
+void EscapeAnalysis::Visit(const Variable& variable)
+{
+    VariableKey key{variable.scope.get(), variable.resolved_name.ToString()};
+    if (target_)
+    {
+        flows_.push_back({key, *target_});
+    }
+    else
+    {
+        escaping_variables_.insert(key);
+    }
+}
+
+void EscapeAnalysis::Visit(const MemberAccessor& member_accessor)
+{
+    VisitEscaping(*member_accessor.object);
+}
+
+void EscapeAnalysis::Visit(const Call& call)
+{
+    // Calling a closure does not make it escape.
+    if (!dynamic_pointer_cast<Variable>(call.function))
+    {
+        VisitEscaping(*call.function);
+    }
+
+    auto callee = GetStaticCallee(call);
+    const std::size_t offset = call.is_method_call ? 1 : 0;
+
+    for (std::size_t i = 0; i < call.arguments->size(); ++i)
+    {
+        const auto& argument = *call.arguments->at(i);
+        if (callee && (i + offset) < callee->parameters->size())
+        {
+            VisitFlowingInto(argument, {callee->locals.get(), callee->parameters->at(i + offset)->name});
+        }
+        else
+        {
+            VisitEscaping(argument);
+        }
+    }
+}
+
+void EscapeAnalysis::Visit(const UnitLiteral&) {}
+void EscapeAnalysis::Visit(const BooleanLiteral&) {}
+void EscapeAnalysis::Visit(const IntegerLiteral&) {}
+void EscapeAnalysis::Visit(const FloatLiteral&) {}
+void EscapeAnalysis::Visit(const CharacterLiteral&) {}
+void EscapeAnalysis::Visit(const StringLiteral&) {}
+
+void EscapeAnalysis::Visit(const Function& function)
+{
+    if (function.captures && !function.captures->empty())
+    {
+        closures_.push_back({&function, target_});
+    }
+
+    if (function.captures)
+    {
+        for (const auto& capture : *function.captures)
+        {
+            VisitEscaping(*capture);
+        }
+    }
+
+    function.body->Accept(*this);
+}
+
+void EscapeAnalysis::Visit(const Initializer& initializer)
+{
+    for (const auto& member_initializer : *initializer.member_initializers)
+    {
+        VisitEscaping(*member_initializer->value);
+    }
+}
+
+void EscapeAnalysis::Visit(const Allocation& allocation)
+{
+    if (allocation.size)
+    {
+        VisitEscaping(*allocation.size);
+    }
+    if (allocation.member_initializers)
+    {
+        for (const auto& member_initializer : *allocation.member_initializers)
+        {
+            VisitEscaping(*member_initializer->value);
+        }
+    }
+}
+
+void EscapeAnalysis::Visit(const Conversion& conversion)
+{
+    VisitEscaping(*conversion.operand);
+}
+
+void EscapeAnalysis::Visit(const ElementAccessor& element_accessor)
+{
+    VisitEscaping(*element_accessor.object);
+    VisitEscaping(*element_accessor.index);
+}
+
+void EscapeAnalysis::Visit(const ArrayLiteral& array_literal)
+{
+    for (const auto& element : *array_literal.elements)
+    {
+        VisitEscaping(*element);
+    }
+}
+
+void EscapeAnalysis::Visit(const Slicing& slicing)
+{
+    VisitEscaping(*slicing.object);
+    if (slicing.lower)
+    {
+        VisitEscaping(*slicing.lower);
+    }
+    if (slicing.upper)
+    {
+        VisitEscaping(*slicing.upper);
+    }
+}
+
+void EscapeAnalysis::VisitEscaping(const Expression& expression)
+{
+    target_ = std::nullopt;
+    expression.Accept(*this);
+}
+
+void EscapeAnalysis::VisitFlowingInto(const Expression& expression, VariableKey target)
+{
+    target_ = std::move(target);
+    expression.Accept(*this);
+    target_ = std::nullopt;
+}
+
+const Function* EscapeAnalysis::GetStaticCallee(const Call& call) const
+{
+    std::string global_name;
+
+    if (auto variable = dynamic_pointer_cast<Variable>(call.function))
+    {
+        if (variable->scope != module_.globals)
+        {
+            return nullptr;
+        }
+        global_name = variable->resolved_name.ToString();
+    }
+    else if (auto member_accessor = dynamic_pointer_cast<MemberAccessor>(call.function))
+    {
+        if (member_accessor->nonstatic_member_index || member_accessor->dereferenced_object_type_scope != module_.globals)
+        {
+            return nullptr;
+        }
+        auto member = member_accessor->dereferenced_object_type->GetMember(member_accessor->member);
+        if (!member->default_initializer_global_name)
+        {
+            return nullptr;
+        }
+        global_name = *member->default_initializer_global_name;
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    auto callee = global_functions_.find(global_name);
+    return (callee != global_functions_.end()) ? callee->second : nullptr;
+}
+
+void EscapeAnalysis::PropagateEscapes()
+{
+    bool changed{true};
+    while (changed)
+    {
+        changed = false;
+        for (const auto& [source, target] : flows_)
+        {
+            if (escaping_variables_.contains(target) && !escaping_variables_.contains(source))
+            {
+                escaping_variables_.insert(source);
+                changed = true;
+            }
+        }
+    }
+}
+
+}  // namespace l0::detail
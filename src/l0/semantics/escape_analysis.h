@@ -0,0 +1,90 @@
+#ifndef L0_SEMANTICS_ESCAPE_ANALYSIS_H
+#define L0_SEMANTICS_ESCAPE_ANALYSIS_H
+
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "l0/ast/expression.h"
+#include "l0/ast/module.h"
+#include "l0/ast/scope.h"
+#include "l0/ast/statement.h"
+
+namespace l0::detail
+{
+
+/// @brief Determines which closure contexts may outlive the frame of the function creating them.
+///
+/// A capturing function literal is considered non-escaping if its value only flows into variables and parameters
+/// (of functions of this module that are called directly) which are themselves only ever called, or passed on to
+/// such variables and parameters. All other uses, e.g. returning, capturing, deleting or storing the value,
+/// make it escape. The contexts of non-escaping closures can be placed on the stack.
+class EscapeAnalysis : private IConstExpressionVisitor, private IConstStatementVisitor
+{
+   public:
+    EscapeAnalysis(const Module& module);
+    void Run();
+
+   private:
+    struct VariableKey
+    {
+        const Scope* scope;
+        std::string name;
+
+        auto operator<=>(const VariableKey&) const = default;
+    };
+
+    const Module& module_;
+
+    std::unordered_map<std::string, const Function*> global_functions_{};
+
+    std::set<VariableKey> escaping_variables_{};
+    std::vector<std::pair<VariableKey, VariableKey>> flows_{};
+    std::vector<std::pair<const Function*, std::optional<VariableKey>>> closures_{};
+
+    std::optional<VariableKey> target_{};
+
+    void Visit(const StatementBlock& statement_block) override;
+    void Visit(const Declaration& declaration) override;
+    void Visit(const TypeDeclaration& type_declaration) override;
+    void Visit(const ExpressionStatement& expression_statement) override;
+    void Visit(const ReturnStatement& return_statement) override;
+    void Visit(const ConditionalStatement& conditional_statement) override;
+    void Visit(const MatchStatement& match_statement) override;
+    void Visit(const WhileLoop& while_loop) override;
+    void Visit(const ForLoop& for_loop) override;
+    void Visit(const Deallocation& deallocation) override;
+
+    void Visit(const Assignment& assignment) override;
+    void Visit(const UnaryOp& unary_op) override;
+    void Visit(const BinaryOp& binary_op) override;
+    void Visit(const Variable& variable) override;
+    void Visit(const MemberAccessor& member_accessor) override;
+    void Visit(const Call& call) override;
+    void Visit(const UnitLiteral& literal) override;
+    void Visit(const BooleanLiteral& literal) override;
+    void Visit(const IntegerLiteral& literal) override;
+    void Visit(const FloatLiteral& literal) override;
+    void Visit(const CharacterLiteral& literal) override;
+    void Visit(const StringLiteral& literal) override;
+    void Visit(const Function& function) override;
+    void Visit(const Initializer& initializer) override;
+    void Visit(const Allocation& allocation) override;
+    void Visit(const Conversion& conversion) override;
+    void Visit(const ElementAccessor& element_accessor) override;
+    void Visit(const ArrayLiteral& array_literal) override;
+    void Visit(const Slicing& slicing) override;
+
+    void VisitEscaping(const Expression& expression);
+    void VisitFlowingInto(const Expression& expression, VariableKey target);
+
+    const Function* GetStaticCallee(const Call& call) const;
+    void PropagateEscapes();
+};
+
+}  // namespace l0::detail
+
+#endif
@@ -11,7 +11,9 @@ void FillTypeDetails(Module& module)
 {
     TypeResolver type_resolver{module};
 
-    for (auto type_declaration : module.global_type_declarations)
+    // instances of generic structs are appended to the declarations as they are used, and filled right away
+    auto type_declarations = module.global_type_declarations;
+    for (auto type_declaration : type_declarations)
     {
         if (auto struct_expression = dynamic_pointer_cast<StructExpression>(type_declaration->definition))
         {
@@ -0,0 +1,233 @@
+#include "l0/semantics/generics.h"
+
+#include <ranges>
+#include <sstream>
+
+#include "l0/semantics/declare_global_types.h"
+#include "l0/semantics/declare_variables.h"
+#include "l0/semantics/fill_types.h"
+#include "l0/semantics/resolver.h"
+#include "l0/semantics/semantic_error.h"
+#include "l0/semantics/type_resolver.h"
+
+namespace l0::detail
+{
+
+namespace
+{
+
+class TypeArgumentInference : private ITypeAnnotationVisitor
+{
+   public:
+    TypeArgumentInference(const Module& module, const GenericDeclaration& generic)
+        : module_{module},
+          generic_{generic},
+          type_arguments_(generic.type_parameters.size())
+    {
+    }
+
+    void Infer(const TypeAnnotation& parameter, std::shared_ptr<Type> argument)
+    {
+        argument_ = argument;
+        parameter.Accept(*this);
+    }
+
+    const std::vector<std::shared_ptr<Type>>& GetTypeArguments() const
+    {
+        return type_arguments_;
+    }
+
+   private:
+    const Module& module_;
+    const GenericDeclaration& generic_;
+    std::vector<std::shared_ptr<Type>> type_arguments_;
+    std::shared_ptr<Type> argument_;
+
+    void Visit(const SimpleTypeAnnotation& sta) override
+    {
+        if (!sta.type_arguments)
+        {
+            auto parameter = std::ranges::find(
+                generic_.type_parameters, sta.type_name, [](const auto& name) { return Identifier{name}; }
+            );
+            auto index = std::distance(generic_.type_parameters.begin(), parameter);
+            if (parameter != generic_.type_parameters.end() && !type_arguments_.at(index))
+            {
+                type_arguments_.at(index) = ModifyQualifier(*argument_, TypeQualifier::Constant);
+            }
+            return;
+        }
+
+        // the type arguments of a generic struct are matched with those of the instance passed
+        auto struct_type = dynamic_pointer_cast<StructType>(argument_);
+        auto instance = struct_type ? module_.generic_instances.find(struct_type->identifier)
+                                    : module_.generic_instances.end();
+        if (instance == module_.generic_instances.end()
+            || instance->second.type_arguments.size() != sta.type_arguments->size())
+        {
+            return;
+        }
+        for (const auto& [annotation, type] : std::views::zip(*sta.type_arguments, instance->second.type_arguments))
+        {
+            Infer(*annotation, type);
+        }
+    }
+
+    void Visit(const ReferenceTypeAnnotation& rta) override
+    {
+        if (auto reference_type = dynamic_pointer_cast<ReferenceType>(argument_))
+        {
+            Infer(*rta.base_type, reference_type->base_type);
+        }
+    }
+
+    void Visit(const ArrayTypeAnnotation& ata) override
+    {
+        if (auto array_type = dynamic_pointer_cast<ArrayType>(argument_))
+        {
+            Infer(*ata.element_type, array_type->element_type);
+        }
+    }
+
+    void Visit(const SliceTypeAnnotation& sta) override
+    {
+        if (auto slice_type = dynamic_pointer_cast<SliceType>(argument_))
+        {
+            Infer(*sta.element_type, slice_type->element_type);
+        }
+    }
+
+    void Visit(const FunctionTypeAnnotation& fta) override
+    {
+        auto function_type = dynamic_pointer_cast<FunctionType>(argument_);
+        if (!function_type || function_type->parameters->size() != fta.parameters->size())
+        {
+            return;
+        }
+        for (const auto& [annotation, type] : std::views::zip(*fta.parameters, *function_type->parameters))
+        {
+            Infer(*annotation, type);
+        }
+        Infer(*fta.return_type, function_type->return_type);
+    }
+
+    void Visit(const MethodTypeAnnotation&) override {}
+    void Visit(const MutabilityOnlyTypeAnnotation&) override {}
+};
+
+}  // namespace
+
+std::shared_ptr<GenericDeclaration> ResolveGeneric(
+    const Module& module, const Identifier& identifier, const Identifier& namespace_
+)
+{
+    // like variables and types, generics are looked up globally first and then in the current namespace
+    for (const auto& candidate : {identifier, namespace_ + identifier})
+    {
+        if (auto generic = module.generics.find(candidate); generic != module.generics.end())
+        {
+            return generic->second;
+        }
+    }
+    return nullptr;
+}
+
+Identifier Instantiate(
+    Module& module, const GenericDeclaration& generic, const std::vector<std::shared_ptr<Type>>& type_arguments
+)
+{
+    if (type_arguments.size() != generic.type_parameters.size())
+    {
+        throw SemanticError(std::format(
+            "Generic '{}' expects {} type arguments, got {}.",
+            generic.identifier.ToString(),
+            generic.type_parameters.size(),
+            type_arguments.size()
+        ));
+    }
+
+    // instances are named after their type arguments, e.g. 'Pair<I64>'
+    std::stringstream name_stream{};
+    name_stream << generic.identifier.GetLast() << "<";
+    for (const auto& [index, argument] : std::views::zip(std::views::iota(0), type_arguments))
+    {
+        name_stream << (index > 0 ? ", " : "") << ModifyQualifier(*argument, TypeQualifier::Constant)->ToString();
+    }
+    name_stream << ">";
+    auto name = name_stream.str();
+    auto identifier = generic.identifier.GetPrefix() + Identifier{name};
+
+    if (module.generic_instances.contains(identifier))
+    {
+        return identifier;
+    }
+    // registering the instance first lets it refer to itself, e.g. in a member of type '&List<T>'
+    module.generic_instances[identifier] = GenericInstance{generic.identifier, type_arguments};
+
+    TypeResolver type_resolver{module};
+    std::vector<std::shared_ptr<Function>> callables{};
+
+    auto instance = generic.instantiate(name, type_arguments);
+    if (auto declaration = std::get_if<std::shared_ptr<Declaration>>(&instance))
+    {
+        module.global_declarations.push_back(*declaration);
+        DeclareGlobalVariable(module, **declaration, type_resolver);
+        callables.push_back(dynamic_pointer_cast<Function>((*declaration)->initializer));
+    }
+    else
+    {
+        auto type_declaration = std::get<std::shared_ptr<TypeDeclaration>>(instance);
+        module.global_type_declarations.push_back(type_declaration);
+        DeclareGlobaType(module, *type_declaration);
+
+        auto struct_type = dynamic_pointer_cast<StructType>(type_declaration->type);
+        auto struct_expression = dynamic_pointer_cast<StructExpression>(type_declaration->definition);
+        FillStructDetails(module, struct_type, *struct_expression, type_resolver);
+        for (const auto& member : *struct_type->members)
+        {
+            if (auto method = dynamic_pointer_cast<Function>(member->default_initializer))
+            {
+                callables.push_back(method);
+            }
+        }
+    }
+
+    // instances created while type checking have missed the resolution of local scopes
+    if (module.are_local_scopes_resolved)
+    {
+        Resolver resolver{module};
+        for (const auto& callable : callables)
+        {
+            resolver.ResolveCallable(*callable);
+        }
+    }
+
+    return identifier;
+}
+
+std::vector<std::shared_ptr<Type>> InferTypeArguments(
+    const Module& module, const GenericDeclaration& generic, const ArgumentList& arguments
+)
+{
+    auto declaration = std::get<std::shared_ptr<Declaration>>(generic.definition);
+    auto function = dynamic_pointer_cast<Function>(declaration->initializer);
+
+    // numeric literals adapt to the types of the other arguments, so they only determine type arguments left open
+    auto is_numeric_literal = [](const auto& argument)
+    { return dynamic_pointer_cast<IntegerLiteral>(argument) || dynamic_pointer_cast<FloatLiteral>(argument); };
+
+    TypeArgumentInference inference{module, generic};
+    for (bool literals : {false, true})
+    {
+        for (const auto& [parameter, argument] : std::views::zip(*function->parameters, arguments))
+        {
+            if (is_numeric_literal(argument) == literals)
+            {
+                inference.Infer(*parameter->annotation, argument->type);
+            }
+        }
+    }
+    return inference.GetTypeArguments();
+}
+
+}  // namespace l0::detail
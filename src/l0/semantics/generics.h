@@ -0,0 +1,32 @@
+#ifndef L0_SEMANTICS_GENERICS_H
+#define L0_SEMANTICS_GENERICS_H
+
+#include <memory>
+#include <vector>
+
+#include "l0/ast/expression.h"
+#include "l0/ast/module.h"
+#include "l0/types/types.h"
+
+namespace l0::detail
+{
+
+std::shared_ptr<GenericDeclaration> ResolveGeneric(
+    const Module& module, const Identifier& identifier, const Identifier& namespace_
+);
+
+// Returns the name of the instance of the generic for the given type arguments. Instances are created on first use
+// and declared like the module's own globals, so that they take part in all subsequent passes.
+Identifier Instantiate(
+    Module& module, const GenericDeclaration& generic, const std::vector<std::shared_ptr<Type>>& type_arguments
+);
+
+// Infers the type arguments of a generic function from the (type checked) arguments of a call. Type arguments that
+// cannot be inferred are left null.
+std::vector<std::shared_ptr<Type>> InferTypeArguments(
+    const Module& module, const GenericDeclaration& generic, const ArgumentList& arguments
+);
+
+}  // namespace l0::detail
+
+#endif
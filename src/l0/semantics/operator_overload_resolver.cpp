@@ -1,68 +1,211 @@
 #include "l0/semantics/operator_overload_resolver.h"
 
+#include <algorithm>
+
 #include "l0/ast/ast_printer.h"
 #include "l0/semantics/semantic_error.h"
 
 namespace l0::detail
 {
 
+namespace
+{
+
+// Integer and floating-point types of all widths share the builtin overloads of their kind
+bool IsSizedNumber(const std::shared_ptr<Type>& type)
+{
+    return dynamic_pointer_cast<IntegerType>(type) || dynamic_pointer_cast<FloatType>(type);
+}
+
+bool IsIntegerKind(TypeKind kind)
+{
+    return kind == TypeKind::Integer || kind == TypeKind::UnsignedInteger;
+}
+
+bool IsSizedNumberKind(TypeKind kind)
+{
+    return IsIntegerKind(kind) || kind == TypeKind::Float;
+}
+
+// Operand types are usually immutable already, in which case they are reused instead of copied.
+std::shared_ptr<Type> GetConstantType(const std::shared_ptr<Type>& type)
+{
+    return type->mutability == TypeQualifier::Constant ? type : ModifyQualifier(*type, TypeQualifier::Constant);
+}
+
+class TypeKindVisitor : private IConstTypeVisitor
+{
+   public:
+    TypeKind GetKind(const Type& type)
+    {
+        type.Accept(*this);
+        return result_;
+    }
+
+   private:
+    TypeKind result_;
+
+    void Visit(const ReferenceType&)
+    {
+        result_ = TypeKind::Reference;
+    }
+
+    void Visit(const UnitType&)
+    {
+        result_ = TypeKind::Unit;
+    }
+
+    void Visit(const BooleanType&)
+    {
+        result_ = TypeKind::Boolean;
+    }
+
+    void Visit(const IntegerType& integer_type)
+    {
+        result_ = integer_type.is_signed ? TypeKind::Integer : TypeKind::UnsignedInteger;
+    }
+
+    void Visit(const FloatType&)
+    {
+        result_ = TypeKind::Float;
+    }
+
+    void Visit(const CharacterType&)
+    {
+        result_ = TypeKind::Character;
+    }
+
+    void Visit(const ArrayType&)
+    {
+        result_ = TypeKind::Array;
+    }
+
+    void Visit(const SliceType&)
+    {
+        result_ = TypeKind::Slice;
+    }
+
+    void Visit(const VectorType&)
+    {
+        result_ = TypeKind::Vector;
+    }
+
+    void Visit(const FunctionType&)
+    {
+        result_ = TypeKind::Function;
+    }
+
+    void Visit(const StructType&)
+    {
+        result_ = TypeKind::Struct;
+    }
+
+    void Visit(const EnumType&)
+    {
+        result_ = TypeKind::Enum;
+    }
+};
+
+}  // namespace
+
+TypeKind GetTypeKind(const Type& type)
+{
+    return TypeKindVisitor{}.GetKind(type);
+}
+
 OperatorOverloadResolver::OperatorOverloadResolver()
+    : boolean_{std::make_shared<BooleanType>(TypeQualifier::Constant)}
 {
-    auto boolean = std::make_shared<BooleanType>(TypeQualifier::Constant);
+    auto boolean = boolean_;
     auto integer = std::make_shared<IntegerType>(TypeQualifier::Constant);
+    auto floating = std::make_shared<FloatType>(TypeQualifier::Constant);
     auto character = std::make_shared<CharacterType>(TypeQualifier::Constant);
 
-    unary_operator_overloads_ = {
-        {UnaryOp::Operator::Plus, {{integer, {integer, UnaryOp::Overload::IntegerIdentity}}}},
-        {UnaryOp::Operator::Minus, {{integer, {integer, UnaryOp::Overload::IntegerNegation}}}},
-        {UnaryOp::Operator::Bang, {{boolean, {boolean, UnaryOp::Overload::BooleanNegation}}}},
-    };
+    using Kind = TypeKind;
+
+    using UnOp = UnaryOp::Operator;
+    using UnOverload = UnaryOp::Overload;
+    SetBuiltin(UnOp::Plus, Kind::Integer, {integer, UnOverload::IntegerIdentity});
+    SetBuiltin(UnOp::Plus, Kind::UnsignedInteger, {integer, UnOverload::IntegerIdentity});
+    SetBuiltin(UnOp::Minus, Kind::Integer, {integer, UnOverload::IntegerNegation});
+    SetBuiltin(UnOp::Tilde, Kind::Integer, {integer, UnOverload::IntegerComplement});
+    SetBuiltin(UnOp::Tilde, Kind::UnsignedInteger, {integer, UnOverload::IntegerComplement});
+    SetBuiltin(UnOp::Plus, Kind::Float, {floating, UnOverload::FloatIdentity});
+    SetBuiltin(UnOp::Minus, Kind::Float, {floating, UnOverload::FloatNegation});
+    SetBuiltin(UnOp::Bang, Kind::Boolean, {boolean, UnOverload::BooleanNegation});
 
     using BinOp = BinaryOp::Operator;
     using BinOverload = BinaryOp::Overload;
-    binary_operator_overloads_ = {
-        {
-            BinOp::EqualsEquals,
-            {
-                {boolean, boolean, {boolean, BinOverload::BooleanEquality}},
-                {integer, integer, {boolean, BinOverload::IntegerEquality}},
-                {character, character, {boolean, BinOverload::CharacterEquality}},
-            },
-        },
-        {
-            BinOp::BangEquals,
-            {
-                {boolean, boolean, {boolean, BinOverload::BooleanInequality}},
-                {integer, integer, {boolean, BinOverload::IntegerInequality}},
-                {character, character, {boolean, BinOverload::CharacterInequality}},
-            },
-        },
-        {
-            BinOp::Plus,
-            {
-                {integer, integer, {integer, BinOverload::IntegerAddition}},
-                {character, integer, {character, BinOverload::CharacterAddition}},
-            },
-        },
-        {
-            BinOp::Minus,
-            {
-                {integer, integer, {integer, BinOverload::IntegerSubtraction}},
-                {character, character, {integer, BinOverload::CharacterSubtraction}},
-            },
-        },
-        {BinOp::Asterisk, {{integer, integer, {integer, BinOverload::IntegerMultiplication}}}},
-        {BinOp::Slash, {{integer, integer, {integer, BinOverload::IntegerDivision}}}},
-        {BinOp::Percent, {{integer, integer, {integer, BinOverload::IntegerRemainder}}}},
-
-        {BinOp::PipePipe, {{boolean, boolean, {boolean, BinOverload::BooleanDisjunction}}}},
-        {BinOp::AmpersandAmpersand, {{boolean, boolean, {boolean, BinOverload::BooleanConjunction}}}},
-
-        {BinOp::Less, {{integer, integer, {boolean, BinOverload::IntegerLess}}}},
-        {BinOp::Greater, {{integer, integer, {boolean, BinOverload::IntegerGreater}}}},
-        {BinOp::LessEquals, {{integer, integer, {boolean, BinOverload::IntegerLessOrEquals}}}},
-        {BinOp::GreaterEquals, {{integer, integer, {boolean, BinOverload::IntegerGreaterOrEquals}}}},
-    };
+    SetBuiltin(BinOp::EqualsEquals, Kind::Boolean, Kind::Boolean, {boolean, BinOverload::BooleanEquality});
+    SetBuiltin(BinOp::EqualsEquals, Kind::Integer, Kind::Integer, {boolean, BinOverload::IntegerEquality});
+    SetBuiltin(BinOp::EqualsEquals, Kind::Character, Kind::Character, {boolean, BinOverload::CharacterEquality});
+
+    SetBuiltin(BinOp::BangEquals, Kind::Boolean, Kind::Boolean, {boolean, BinOverload::BooleanInequality});
+    SetBuiltin(BinOp::BangEquals, Kind::Integer, Kind::Integer, {boolean, BinOverload::IntegerInequality});
+    SetBuiltin(BinOp::BangEquals, Kind::Character, Kind::Character, {boolean, BinOverload::CharacterInequality});
+
+    SetBuiltin(BinOp::Plus, Kind::Integer, Kind::Integer, {integer, BinOverload::IntegerAddition});
+    SetBuiltin(BinOp::Plus, Kind::Character, Kind::Integer, {character, BinOverload::CharacterAddition});
+
+    SetBuiltin(BinOp::Minus, Kind::Integer, Kind::Integer, {integer, BinOverload::IntegerSubtraction});
+    SetBuiltin(BinOp::Minus, Kind::Character, Kind::Character, {integer, BinOverload::CharacterSubtraction});
+
+    SetBuiltin(BinOp::Asterisk, Kind::Integer, Kind::Integer, {integer, BinOverload::IntegerMultiplication});
+    SetBuiltin(BinOp::Slash, Kind::Integer, Kind::Integer, {integer, BinOverload::IntegerDivision});
+    SetBuiltin(BinOp::Percent, Kind::Integer, Kind::Integer, {integer, BinOverload::IntegerRemainder});
+
+    SetBuiltin(BinOp::PipePipe, Kind::Boolean, Kind::Boolean, {boolean, BinOverload::BooleanDisjunction});
+    SetBuiltin(BinOp::AmpersandAmpersand, Kind::Boolean, Kind::Boolean, {boolean, BinOverload::BooleanConjunction});
+
+    SetBuiltin(BinOp::Less, Kind::Integer, Kind::Integer, {boolean, BinOverload::IntegerLess});
+    SetBuiltin(BinOp::Greater, Kind::Integer, Kind::Integer, {boolean, BinOverload::IntegerGreater});
+    SetBuiltin(BinOp::LessEquals, Kind::Integer, Kind::Integer, {boolean, BinOverload::IntegerLessOrEquals});
+    SetBuiltin(BinOp::GreaterEquals, Kind::Integer, Kind::Integer, {boolean, BinOverload::IntegerGreaterOrEquals});
+
+    SetBuiltin(BinOp::Ampersand, Kind::Integer, Kind::Integer, {integer, BinOverload::IntegerBitwiseAnd});
+    SetBuiltin(BinOp::Pipe, Kind::Integer, Kind::Integer, {integer, BinOverload::IntegerBitwiseOr});
+    SetBuiltin(BinOp::Tilde, Kind::Integer, Kind::Integer, {integer, BinOverload::IntegerBitwiseXor});
+    SetBuiltin(BinOp::LessLess, Kind::Integer, Kind::Integer, {integer, BinOverload::IntegerShiftLeft});
+    SetBuiltin(BinOp::GreaterGreater, Kind::Integer, Kind::Integer, {integer, BinOverload::IntegerShiftRight});
+
+    // Wrapping arithmetic, bitwise operators and equality do not depend on the signedness; division, remainder,
+    // comparisons and right shifts do.
+    auto unsigned_integer = Kind::UnsignedInteger;
+    SetBuiltin(BinOp::EqualsEquals, unsigned_integer, unsigned_integer, {boolean, BinOverload::IntegerEquality});
+    SetBuiltin(BinOp::BangEquals, unsigned_integer, unsigned_integer, {boolean, BinOverload::IntegerInequality});
+    SetBuiltin(BinOp::Plus, unsigned_integer, unsigned_integer, {integer, BinOverload::IntegerAddition});
+    SetBuiltin(BinOp::Plus, Kind::Character, unsigned_integer, {character, BinOverload::CharacterAddition});
+    SetBuiltin(BinOp::Minus, unsigned_integer, unsigned_integer, {integer, BinOverload::IntegerSubtraction});
+    SetBuiltin(BinOp::Asterisk, unsigned_integer, unsigned_integer, {integer, BinOverload::IntegerMultiplication});
+    SetBuiltin(BinOp::Slash, unsigned_integer, unsigned_integer, {integer, BinOverload::UnsignedIntegerDivision});
+    SetBuiltin(BinOp::Percent, unsigned_integer, unsigned_integer, {integer, BinOverload::UnsignedIntegerRemainder});
+    SetBuiltin(BinOp::Less, unsigned_integer, unsigned_integer, {boolean, BinOverload::UnsignedIntegerLess});
+    SetBuiltin(BinOp::Greater, unsigned_integer, unsigned_integer, {boolean, BinOverload::UnsignedIntegerGreater});
+    SetBuiltin(
+        BinOp::LessEquals, unsigned_integer, unsigned_integer, {boolean, BinOverload::UnsignedIntegerLessOrEquals}
+    );
+    SetBuiltin(
+        BinOp::GreaterEquals, unsigned_integer, unsigned_integer, {boolean, BinOverload::UnsignedIntegerGreaterOrEquals}
+    );
+    SetBuiltin(BinOp::Ampersand, unsigned_integer, unsigned_integer, {integer, BinOverload::IntegerBitwiseAnd});
+    SetBuiltin(BinOp::Pipe, unsigned_integer, unsigned_integer, {integer, BinOverload::IntegerBitwiseOr});
+    SetBuiltin(BinOp::Tilde, unsigned_integer, unsigned_integer, {integer, BinOverload::IntegerBitwiseXor});
+    SetBuiltin(BinOp::LessLess, unsigned_integer, unsigned_integer, {integer, BinOverload::IntegerShiftLeft});
+    SetBuiltin(
+        BinOp::GreaterGreater, unsigned_integer, unsigned_integer, {integer, BinOverload::UnsignedIntegerShiftRight}
+    );
+
+    SetBuiltin(BinOp::EqualsEquals, Kind::Float, Kind::Float, {boolean, BinOverload::FloatEquality});
+    SetBuiltin(BinOp::BangEquals, Kind::Float, Kind::Float, {boolean, BinOverload::FloatInequality});
+    SetBuiltin(BinOp::Plus, Kind::Float, Kind::Float, {floating, BinOverload::FloatAddition});
+    SetBuiltin(BinOp::Minus, Kind::Float, Kind::Float, {floating, BinOverload::FloatSubtraction});
+    SetBuiltin(BinOp::Asterisk, Kind::Float, Kind::Float, {floating, BinOverload::FloatMultiplication});
+    SetBuiltin(BinOp::Slash, Kind::Float, Kind::Float, {floating, BinOverload::FloatDivision});
+    SetBuiltin(BinOp::Percent, Kind::Float, Kind::Float, {floating, BinOverload::FloatRemainder});
+    SetBuiltin(BinOp::Less, Kind::Float, Kind::Float, {boolean, BinOverload::FloatLess});
+    SetBuiltin(BinOp::Greater, Kind::Float, Kind::Float, {boolean, BinOverload::FloatGreater});
+    SetBuiltin(BinOp::LessEquals, Kind::Float, Kind::Float, {boolean, BinOverload::FloatLessOrEquals});
+    SetBuiltin(BinOp::GreaterEquals, Kind::Float, Kind::Float, {boolean, BinOverload::FloatGreaterOrEquals});
 }
 
 OperatorOverloadResolver::UnaryOpResolution OperatorOverloadResolver::ResolveUnaryOperator(
@@ -85,21 +228,33 @@ OperatorOverloadResolver::UnaryOpResolution OperatorOverloadResolver::ResolveUna
         }
     }
 
-    if (!unary_operator_overloads_.contains(op))
+    auto operand_kind = GetTypeKind(*operand);
+    if (operand_kind == TypeKind::Vector)
     {
-        throw SemanticError(std::format("No known overloads of unary operator '{}'.", str(op)));
+        return ResolveLaneWiseUnaryOperator(op, static_cast<const VectorType&>(*operand));
     }
 
-    auto& candidates = unary_operator_overloads_.at(op);
-    auto matching_signature = std::find_if(
-        candidates.cbegin(),
-        candidates.cend(),
-        [&](const UnaryOpSignature& signature) { return *signature.operand == *operand; }
-    );
+    auto& builtin = unary_operator_table_[std::to_underlying(op)][std::to_underlying(operand_kind)];
+    if (builtin)
+    {
+        // builtin numeric overloads are shared by all widths and yield a value of the operand type
+        if (IsSizedNumberKind(operand_kind) && builtin->result_type != boolean_)
+        {
+            return {GetConstantType(operand), builtin->overload};
+        }
+        return *builtin;
+    }
 
-    if (matching_signature != candidates.cend())
+    if (auto candidates = unary_operator_overloads_.find(GetSignatureHash(op, operand_kind));
+        candidates != unary_operator_overloads_.end())
     {
-        return matching_signature->resolution;
+        auto matching_signature = std::ranges::find_if(
+            candidates->second, [&](const UnaryOpSignature& signature) { return *signature.operand == *operand; }
+        );
+        if (matching_signature != candidates->second.end())
+        {
+            return matching_signature->resolution;
+        }
     }
 
     throw SemanticError(std::format(
@@ -111,43 +266,65 @@ OperatorOverloadResolver::BinaryOpResolution OperatorOverloadResolver::ResolveBi
     BinaryOp::Operator op, std::shared_ptr<Type> lhs, std::shared_ptr<Type> rhs
 ) const
 {
-    if (op == BinaryOp::Operator::Plus)
+    auto lhs_kind = GetTypeKind(*lhs);
+    auto rhs_kind = GetTypeKind(*rhs);
+
+    if (lhs_kind == TypeKind::Vector && rhs_kind == TypeKind::Vector)
     {
-        auto reference_type = dynamic_pointer_cast<ReferenceType>(lhs);
-        if (reference_type && *rhs == IntegerType{TypeQualifier::Constant})
-        {
-            return {lhs, BinaryOp::Overload::ReferenceIndexation};
-        }
+        return ResolveLaneWiseBinaryOperator(
+            op, static_cast<const VectorType&>(*lhs), static_cast<const VectorType&>(*rhs)
+        );
     }
-    if (op == BinaryOp::Operator::EqualsEquals || op == BinaryOp::Operator::BangEquals)
-    {
-        auto lhs_as_enum = dynamic_pointer_cast<EnumType>(lhs);
-        auto rhs_as_enum = dynamic_pointer_cast<EnumType>(rhs);
 
-        if (lhs_as_enum && rhs_as_enum && *lhs_as_enum == *rhs_as_enum)
-        {
-            auto boolean = std::make_shared<BooleanType>(TypeQualifier::Constant);
-            auto overload = (op == BinaryOp::Operator::EqualsEquals) ? BinaryOp::Overload::EnumMemberEquality
-                                                                     : BinaryOp::Overload::EnumMemberInequality;
-            return {boolean, overload};
-        }
+    if (op == BinaryOp::Operator::Plus && lhs_kind == TypeKind::Reference && rhs_kind == TypeKind::Integer)
+    {
+        return {lhs, BinaryOp::Overload::ReferenceIndexation};
+    }
+    if ((op == BinaryOp::Operator::EqualsEquals || op == BinaryOp::Operator::BangEquals)
+        && lhs_kind == TypeKind::Enum && rhs_kind == TypeKind::Enum && *lhs == *rhs)
+    {
+        auto overload = (op == BinaryOp::Operator::EqualsEquals) ? BinaryOp::Overload::EnumMemberEquality
+                                                                 : BinaryOp::Overload::EnumMemberInequality;
+        return {boolean_, overload};
     }
 
-    if (!binary_operator_overloads_.contains(op))
+    bool integer_operands = IsIntegerKind(lhs_kind) && IsIntegerKind(rhs_kind);
+    bool float_operands = lhs_kind == TypeKind::Float && rhs_kind == TypeKind::Float;
+    bool numeric_operands = integer_operands || float_operands;
+    if (numeric_operands && !(*lhs == *rhs))
     {
-        throw SemanticError(std::format("No known overloads of binary operator '{}'.", str(op)));
+        throw SemanticError(std::format(
+            "Operands of binary operator '{}' have different {} types '{}' and '{}'; convert one explicitly.",
+            str(op),
+            integer_operands ? "integer" : "floating-point",
+            lhs->ToString(),
+            rhs->ToString()
+        ));
     }
 
-    auto& candidates = binary_operator_overloads_.at(op);
-    auto matching_signature = std::find_if(
-        candidates.cbegin(),
-        candidates.cend(),
-        [&](const BinaryOpSignature& signature) { return (*signature.lhs == *lhs) && (*signature.rhs == *rhs); }
-    );
+    auto& builtin =
+        binary_operator_table_[std::to_underlying(op)][std::to_underlying(lhs_kind)][std::to_underlying(rhs_kind)];
+    if (builtin)
+    {
+        // builtin numeric overloads are shared by all widths and yield a boolean or a value of the operand type
+        if (numeric_operands && builtin->result_type != boolean_)
+        {
+            return {GetConstantType(lhs), builtin->overload};
+        }
+        return *builtin;
+    }
 
-    if (matching_signature != candidates.cend())
+    if (auto candidates = binary_operator_overloads_.find(GetSignatureHash(op, lhs_kind, rhs_kind));
+        candidates != binary_operator_overloads_.end())
     {
-        return matching_signature->resolution;
+        auto matching_signature = std::ranges::find_if(
+            candidates->second,
+            [&](const BinaryOpSignature& signature) { return (*signature.lhs == *lhs) && (*signature.rhs == *rhs); }
+        );
+        if (matching_signature != candidates->second.end())
+        {
+            return matching_signature->resolution;
+        }
     }
 
     throw SemanticError(std::format(
@@ -158,4 +335,96 @@ OperatorOverloadResolver::BinaryOpResolution OperatorOverloadResolver::ResolveBi
     ));
 }
 
+OperatorOverloadResolver::UnaryOpResolution OperatorOverloadResolver::ResolveLaneWiseUnaryOperator(
+    UnaryOp::Operator op, const VectorType& operand
+) const
+{
+    auto element_kind = GetTypeKind(*operand.element_type);
+    auto& builtin = unary_operator_table_[std::to_underlying(op)][std::to_underlying(element_kind)];
+    if (!builtin)
+    {
+        throw SemanticError(std::format(
+            "No viable overload of unary operator '{}' with operand of type '{}'.", str(op), operand.ToString()
+        ));
+    }
+
+    auto element_type = IsSizedNumber(builtin->result_type)
+                          ? ModifyQualifier(*operand.element_type, TypeQualifier::Constant)
+                          : builtin->result_type;
+    return {std::make_shared<VectorType>(element_type, operand.lanes, TypeQualifier::Constant), builtin->overload};
+}
+
+OperatorOverloadResolver::BinaryOpResolution OperatorOverloadResolver::ResolveLaneWiseBinaryOperator(
+    BinaryOp::Operator op, const VectorType& lhs, const VectorType& rhs
+) const
+{
+    if (!(lhs == rhs))
+    {
+        throw SemanticError(std::format(
+            "Operands of binary operator '{}' have different vector types '{}' and '{}'; convert one explicitly.",
+            str(op),
+            lhs.ToString(),
+            rhs.ToString()
+        ));
+    }
+
+    // character subtraction yields I64 differences, which do not fit into the lanes of character vectors
+    auto element_kind = std::to_underlying(GetTypeKind(*lhs.element_type));
+    auto& builtin = binary_operator_table_[std::to_underlying(op)][element_kind][element_kind];
+    if (!builtin || builtin->overload == BinaryOp::Overload::CharacterSubtraction)
+    {
+        throw SemanticError(std::format(
+            "No viable overload of binary operator '{}' with left-hand side of type '{}' and right-hand side of type "
+            "'{}'.",
+            str(op),
+            lhs.ToString(),
+            rhs.ToString()
+        ));
+    }
+
+    auto element_type = IsSizedNumber(builtin->result_type)
+                          ? ModifyQualifier(*lhs.element_type, TypeQualifier::Constant)
+                          : builtin->result_type;
+    return {std::make_shared<VectorType>(element_type, lhs.lanes, TypeQualifier::Constant), builtin->overload};
+}
+
+void OperatorOverloadResolver::DeclareUnaryOperatorOverload(
+    UnaryOp::Operator op, std::shared_ptr<Type> operand, UnaryOpResolution resolution
+)
+{
+    auto& candidates = unary_operator_overloads_[GetSignatureHash(op, GetTypeKind(*operand))];
+    candidates.push_back({operand, resolution});
+}
+
+void OperatorOverloadResolver::DeclareBinaryOperatorOverload(
+    BinaryOp::Operator op, std::shared_ptr<Type> lhs, std::shared_ptr<Type> rhs, BinaryOpResolution resolution
+)
+{
+    auto& candidates = binary_operator_overloads_[GetSignatureHash(op, GetTypeKind(*lhs), GetTypeKind(*rhs))];
+    candidates.push_back({lhs, rhs, resolution});
+}
+
+void OperatorOverloadResolver::SetBuiltin(UnaryOp::Operator op, TypeKind operand, UnaryOpResolution resolution)
+{
+    unary_operator_table_[std::to_underlying(op)][std::to_underlying(operand)] = resolution;
+}
+
+void OperatorOverloadResolver::SetBuiltin(
+    BinaryOp::Operator op, TypeKind lhs, TypeKind rhs, BinaryOpResolution resolution
+)
+{
+    binary_operator_table_[std::to_underlying(op)][std::to_underlying(lhs)][std::to_underlying(rhs)] = resolution;
+}
+
+std::size_t OperatorOverloadResolver::GetSignatureHash(UnaryOp::Operator op, TypeKind operand)
+{
+    return std::to_underlying(op) * kTypeKindCount + std::to_underlying(operand);
+}
+
+std::size_t OperatorOverloadResolver::GetSignatureHash(BinaryOp::Operator op, TypeKind lhs, TypeKind rhs)
+{
+    return (std::to_underlying(op) * kTypeKindCount + std::to_underlying(lhs)) * kTypeKindCount
+         + std::to_underlying(rhs);
+}
+
 }  // namespace l0::detail
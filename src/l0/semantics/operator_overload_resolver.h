@@ -1,8 +1,12 @@
 #ifndef L0_SEMANTICS_BINARY_OP_OVERLOAD_RESOLVER_H
 #define L0_SEMANTICS_BINARY_OP_OVERLOAD_RESOLVER_H
 
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "l0/ast/expression.h"
@@ -11,6 +15,25 @@
 namespace l0::detail
 {
 
+enum class TypeKind
+{
+    Reference,
+    Unit,
+    Boolean,
+    Integer,
+    UnsignedInteger,
+    Float,
+    Character,
+    Array,
+    Slice,
+    Vector,
+    Function,
+    Struct,
+    Enum,
+};
+
+TypeKind GetTypeKind(const Type& type);
+
 class OperatorOverloadResolver
 {
    public:
@@ -32,7 +55,38 @@ class OperatorOverloadResolver
         BinaryOp::Operator op, std::shared_ptr<Type> lhs, std::shared_ptr<Type> rhs
     ) const;
 
+    void DeclareUnaryOperatorOverload(
+        UnaryOp::Operator op, std::shared_ptr<Type> operand, UnaryOpResolution resolution
+    );
+    void DeclareBinaryOperatorOverload(
+        BinaryOp::Operator op, std::shared_ptr<Type> lhs, std::shared_ptr<Type> rhs, BinaryOpResolution resolution
+    );
+
    private:
+    static constexpr std::size_t kTypeKindCount = std::to_underlying(TypeKind::Enum) + 1;
+    static constexpr std::size_t kUnaryOperatorCount = std::to_underlying(UnaryOp::Operator::Tilde) + 1;
+    static constexpr std::size_t kBinaryOperatorCount = std::to_underlying(BinaryOp::Operator::GreaterGreater) + 1;
+
+    // Builtin overloads only depend on the kinds of the operand types, so they are resolved by direct indexing.
+    using UnaryOpTable = std::array<std::array<std::optional<UnaryOpResolution>, kTypeKindCount>, kUnaryOperatorCount>;
+    using BinaryOpTable = std::array<
+        std::array<std::array<std::optional<BinaryOpResolution>, kTypeKindCount>, kTypeKindCount>,
+        kBinaryOperatorCount>;
+
+    UnaryOpTable unary_operator_table_{};
+    BinaryOpTable binary_operator_table_{};
+
+    // Vectors apply the builtin operators of their element type lane-wise, yielding vectors of the results.
+    UnaryOpResolution ResolveLaneWiseUnaryOperator(UnaryOp::Operator op, const VectorType& operand) const;
+    BinaryOpResolution ResolveLaneWiseBinaryOperator(
+        BinaryOp::Operator op, const VectorType& lhs, const VectorType& rhs
+    ) const;
+
+    void SetBuiltin(UnaryOp::Operator op, TypeKind operand, UnaryOpResolution resolution);
+    void SetBuiltin(BinaryOp::Operator op, TypeKind lhs, TypeKind rhs, BinaryOpResolution resolution);
+
+    // Overloads on types that are not fully described by their kind (e.g. structs) are looked up by a hash of the
+    // operator and the operand kinds, and then matched structurally within the (typically tiny) bucket.
     struct UnaryOpSignature
     {
         std::shared_ptr<Type> operand;
@@ -46,8 +100,13 @@ class OperatorOverloadResolver
         BinaryOpResolution resolution;
     };
 
-    std::unordered_map<UnaryOp::Operator, std::vector<UnaryOpSignature>> unary_operator_overloads_;
-    std::unordered_map<BinaryOp::Operator, std::vector<BinaryOpSignature>> binary_operator_overloads_;
+    static std::size_t GetSignatureHash(UnaryOp::Operator op, TypeKind operand);
+    static std::size_t GetSignatureHash(BinaryOp::Operator op, TypeKind lhs, TypeKind rhs);
+
+    std::unordered_map<std::size_t, std::vector<UnaryOpSignature>> unary_operator_overloads_;
+    std::unordered_map<std::size_t, std::vector<BinaryOpSignature>> binary_operator_overloads_;
+
+    std::shared_ptr<Type> boolean_;
 };
 
 }  // namespace l0::detail
@@ -57,12 +57,33 @@ void ReferencePass::Visit(ConditionalStatement& conditional_statement)
     }
 }
 
+void ReferencePass::Visit(MatchStatement& match_statement)
+{
+    match_statement.subject->Accept(*this);
+    for (auto& match_case : *match_statement.cases)
+    {
+        match_case->body->Accept(*this);
+    }
+
+    if (match_statement.else_block)
+    {
+        match_statement.else_block->Accept(*this);
+    }
+}
+
 void ReferencePass::Visit(WhileLoop& while_loop)
 {
     while_loop.condition->Accept(*this);
     while_loop.body->Accept(*this);
 }
 
+void ReferencePass::Visit(ForLoop& for_loop)
+{
+    for_loop.begin->Accept(*this);
+    for_loop.end->Accept(*this);
+    for_loop.body->Accept(*this);
+}
+
 void ReferencePass::Visit(Deallocation& deallocation)
 {
     deallocation.reference->Accept(*this);
@@ -120,6 +141,7 @@ void ReferencePass::Visit(Call& call)
 void ReferencePass::Visit(UnitLiteral&) {}
 void ReferencePass::Visit(BooleanLiteral&) {}
 void ReferencePass::Visit(IntegerLiteral&) {}
+void ReferencePass::Visit(FloatLiteral&) {}
 void ReferencePass::Visit(CharacterLiteral&) {}
 void ReferencePass::Visit(StringLiteral&) {}
 
@@ -151,6 +173,44 @@ void ReferencePass::Visit(Allocation& allocation)
     }
 }
 
+void ReferencePass::Visit(Conversion& conversion)
+{
+    conversion.operand->Accept(*this);
+}
+
+void ReferencePass::Visit(ElementAccessor& element_accessor)
+{
+    element_accessor.object->Accept(*this);
+    element_accessor.index->Accept(*this);
+}
+
+void ReferencePass::Visit(ArrayLiteral& array_literal)
+{
+    for (const auto& element : *array_literal.elements)
+    {
+        element->Accept(*this);
+    }
+}
+
+void ReferencePass::Visit(Slicing& slicing)
+{
+    slicing.object->Accept(*this);
+    if (slicing.lower)
+    {
+        slicing.lower->Accept(*this);
+    }
+    if (slicing.upper)
+    {
+        slicing.upper->Accept(*this);
+    }
+
+    // a slice of an array points into its storage
+    if (dynamic_pointer_cast<ArrayType>(slicing.dereferenced_object_type) && !IsLValue(slicing.dereferenced_object))
+    {
+        throw SemanticError("Can only slice arrays that are lvalues.");
+    }
+}
+
 void ReferencePass::Visit(StructExpression& struct_expression)
 {
     for (const auto& member_declaration : *struct_expression.members)
@@ -179,6 +239,16 @@ bool ReferencePass::IsLValue(std::shared_ptr<Expression> value) const
     {
         return member_accessor->nonstatic_member_index.has_value() && IsLValue(member_accessor->object);
     }
+    else if (auto element_accessor = dynamic_pointer_cast<ElementAccessor>(value))
+    {
+        // the elements of slices are stored elsewhere, like the targets of references; shuffles yield new vectors
+        if (element_accessor->shuffle_mask)
+        {
+            return false;
+        }
+        return dynamic_pointer_cast<SliceType>(element_accessor->dereferenced_object_type)
+            || IsLValue(element_accessor->dereferenced_object);
+    }
     return false;
 }
 
@@ -32,7 +32,9 @@ class ReferencePass : private IStatementVisitor, private IExpressionVisitor, pri
     void Visit(ExpressionStatement& expression_statement) override;
     void Visit(ReturnStatement& return_statement) override;
     void Visit(ConditionalStatement& conditional_statement) override;
+    void Visit(MatchStatement& match_statement) override;
     void Visit(WhileLoop& while_loop) override;
+    void Visit(ForLoop& for_loop) override;
     void Visit(Deallocation& deallocation) override;
 
     void Visit(Assignment& assignment) override;
@@ -44,11 +46,16 @@ class ReferencePass : private IStatementVisitor, private IExpressionVisitor, pri
     void Visit(UnitLiteral& literal) override;
     void Visit(BooleanLiteral& literal) override;
     void Visit(IntegerLiteral& literal) override;
+    void Visit(FloatLiteral& literal) override;
     void Visit(CharacterLiteral& literal) override;
     void Visit(StringLiteral& literal) override;
     void Visit(Function& function) override;
     void Visit(Initializer& initializer) override;
     void Visit(Allocation& allocation) override;
+    void Visit(Conversion& conversion) override;
+    void Visit(ElementAccessor& element_accessor) override;
+    void Visit(ArrayLiteral& array_literal) override;
+    void Visit(Slicing& slicing) override;
 
     void Visit(StructExpression& struct_expression) override;
     void Visit(EnumExpression& enum_expression) override;
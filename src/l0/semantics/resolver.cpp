@@ -2,6 +2,7 @@
 
 #include <ranges>
 
+#include "l0/semantics/generics.h"
 #include "l0/semantics/semantic_error.h"
 
 namespace l0::detail
@@ -22,12 +23,29 @@ void Resolver::Run()
 
     namespaces_.push(Identifier{});
 
+    for (auto declaration : module_.global_declarations)
+    {
+        if (!dynamic_pointer_cast<Function>(declaration->initializer))
+        {
+            namespaces_.push(declaration->identifier.GetPrefix());
+            declaration->initializer->Accept(*this);
+            namespaces_.pop();
+        }
+    }
+
     for (auto callable : module_.callables)
     {
         callable->Accept(*this);
     }
 }
 
+void Resolver::ResolveCallable(const Function& callable)
+{
+    namespaces_.push(Identifier{});
+    callable.Accept(*this);
+    namespaces_.pop();
+}
+
 void Resolver::Visit(const StatementBlock& statement_block)
 {
     for (auto statement : statement_block.statements)
@@ -87,6 +105,36 @@ void Resolver::Visit(const ConditionalStatement& conditional_statement)
     scopes_.pop_back();
 }
 
+void Resolver::Visit(const MatchStatement& match_statement)
+{
+    match_statement.subject->Accept(*this);
+
+    for (const auto& match_case : *match_statement.cases)
+    {
+        for (const auto& pattern : *match_case->patterns)
+        {
+            pattern->value->Accept(*this);
+            if (pattern->end)
+            {
+                pattern->end->Accept(*this);
+            }
+        }
+
+        scopes_.push_back(std::make_shared<Scope>());
+        match_case->body->Accept(*this);
+        scopes_.pop_back();
+    }
+
+    if (!match_statement.else_block)
+    {
+        return;
+    }
+
+    scopes_.push_back(std::make_shared<Scope>());
+    match_statement.else_block->Accept(*this);
+    scopes_.pop_back();
+}
+
 void Resolver::Visit(const WhileLoop& while_loop)
 {
     while_loop.condition->Accept(*this);
@@ -96,6 +144,20 @@ void Resolver::Visit(const WhileLoop& while_loop)
     scopes_.pop_back();
 }
 
+void Resolver::Visit(const ForLoop& for_loop)
+{
+    for_loop.begin->Accept(*this);
+    for_loop.end->Accept(*this);
+
+    auto scope = std::make_shared<Scope>();
+    scope->DeclareVariable(for_loop.variable);
+    for_loop.scope = scope;
+
+    scopes_.push_back(scope);
+    for_loop.body->Accept(*this);
+    scopes_.pop_back();
+}
+
 void Resolver::Visit(const Deallocation& deallocation)
 {
     deallocation.reference->Accept(*this);
@@ -120,6 +182,15 @@ void Resolver::Visit(const BinaryOp& binary_op)
 
 void Resolver::Visit(const Variable& variable)
 {
+    // generic functions are resolved by the typechecker, which instantiates them once their type arguments are known
+    const auto& namespace_ = namespaces_.top();
+    if (variable.type_arguments
+        || (!Resolve(variable.name) && !Resolve(namespace_ + variable.name)
+            && ResolveGeneric(module_, variable.name, namespace_)))
+    {
+        return;
+    }
+
     const auto [scope, resolved_name] = Resolve(variable.name, namespaces_.top());
     variable.scope = scope;
     variable.resolved_name = resolved_name;
@@ -142,6 +213,7 @@ void Resolver::Visit(const Call& call)
 void Resolver::Visit(const UnitLiteral&) {}
 void Resolver::Visit(const BooleanLiteral&) {}
 void Resolver::Visit(const IntegerLiteral&) {}
+void Resolver::Visit(const FloatLiteral&) {}
 void Resolver::Visit(const CharacterLiteral&) {}
 void Resolver::Visit(const StringLiteral&) {}
 
@@ -198,6 +270,38 @@ void Resolver::Visit(const Allocation& allocation)
     }
 }
 
+void Resolver::Visit(const Conversion& conversion)
+{
+    conversion.operand->Accept(*this);
+}
+
+void Resolver::Visit(const ElementAccessor& element_accessor)
+{
+    element_accessor.object->Accept(*this);
+    element_accessor.index->Accept(*this);
+}
+
+void Resolver::Visit(const ArrayLiteral& array_literal)
+{
+    for (const auto& element : *array_literal.elements)
+    {
+        element->Accept(*this);
+    }
+}
+
+void Resolver::Visit(const Slicing& slicing)
+{
+    slicing.object->Accept(*this);
+    if (slicing.lower)
+    {
+        slicing.lower->Accept(*this);
+    }
+    if (slicing.upper)
+    {
+        slicing.upper->Accept(*this);
+    }
+}
+
 void Resolver::Visit(const StructExpression&)
 {
     throw SemanticError("Obsolete");
@@ -19,6 +19,7 @@ class Resolver : private IConstExpressionVisitor, private IConstStatementVisitor
     Resolver(const Module& module);
 
     void Run();
+    void ResolveCallable(const Function& callable);
 
    private:
     const Module& module_;
@@ -31,7 +32,9 @@ class Resolver : private IConstExpressionVisitor, private IConstStatementVisitor
     void Visit(const ExpressionStatement& expression_statement) override;
     void Visit(const ReturnStatement& return_statement) override;
     void Visit(const ConditionalStatement& conditional_statement) override;
+    void Visit(const MatchStatement& match_statement) override;
     void Visit(const WhileLoop& while_loop) override;
+    void Visit(const ForLoop& for_loop) override;
     void Visit(const Deallocation& deallocation) override;
 
     void Visit(const Assignment& assignment) override;
@@ -43,11 +46,16 @@ class Resolver : private IConstExpressionVisitor, private IConstStatementVisitor
     void Visit(const UnitLiteral& literal) override;
     void Visit(const BooleanLiteral& literal) override;
     void Visit(const IntegerLiteral& literal) override;
+    void Visit(const FloatLiteral& literal) override;
     void Visit(const CharacterLiteral& literal) override;
     void Visit(const StringLiteral& literal) override;
     void Visit(const Function& function) override;
     void Visit(const Initializer& initializer) override;
     void Visit(const Allocation& allocation) override;
+    void Visit(const Conversion& conversion) override;
+    void Visit(const ElementAccessor& element_accessor) override;
+    void Visit(const ArrayLiteral& array_literal) override;
+    void Visit(const Slicing& slicing) override;
 
     void Visit(const StructExpression& struct_expression) override;
     void Visit(const EnumExpression& enum_expression) override;
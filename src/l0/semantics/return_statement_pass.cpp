@@ -91,6 +91,29 @@ void ReturnStatementPass::Visit(ConditionalStatement& conditional_statement)
     statement_returns_ = conditional_statement.then_block_returns && conditional_statement.else_block_returns;
 }
 
+void ReturnStatementPass::Visit(MatchStatement& match_statement)
+{
+    match_statement.subject->Accept(*this);
+
+    // the typechecker has ensured that every value of the subject is matched by some case
+    bool all_cases_return{true};
+    for (auto& match_case : *match_statement.cases)
+    {
+        match_case->body->Accept(*this);
+        match_case->body_returns = statement_returns_;
+        all_cases_return = all_cases_return && match_case->body_returns;
+    }
+
+    if (match_statement.else_block)
+    {
+        match_statement.else_block->Accept(*this);
+        match_statement.else_block_returns = statement_returns_;
+        all_cases_return = all_cases_return && match_statement.else_block_returns;
+    }
+
+    statement_returns_ = all_cases_return;
+}
+
 void ReturnStatementPass::Visit(WhileLoop& while_loop)
 {
     while_loop.condition->Accept(*this);
@@ -98,6 +121,14 @@ void ReturnStatementPass::Visit(WhileLoop& while_loop)
     statement_returns_ = false;
 }
 
+void ReturnStatementPass::Visit(ForLoop& for_loop)
+{
+    for_loop.begin->Accept(*this);
+    for_loop.end->Accept(*this);
+    for_loop.body->Accept(*this);
+    statement_returns_ = false;
+}
+
 void ReturnStatementPass::Visit(Deallocation& deallocation)
 {
     deallocation.reference->Accept(*this);
@@ -140,6 +171,7 @@ void ReturnStatementPass::Visit(Call& call)
 void ReturnStatementPass::Visit(UnitLiteral&) {}
 void ReturnStatementPass::Visit(BooleanLiteral&) {}
 void ReturnStatementPass::Visit(IntegerLiteral&) {}
+void ReturnStatementPass::Visit(FloatLiteral&) {}
 void ReturnStatementPass::Visit(CharacterLiteral&) {}
 void ReturnStatementPass::Visit(StringLiteral&) {}
 
@@ -195,6 +227,38 @@ void ReturnStatementPass::Visit(Allocation& allocation)
     }
 }
 
+void ReturnStatementPass::Visit(Conversion& conversion)
+{
+    conversion.operand->Accept(*this);
+}
+
+void ReturnStatementPass::Visit(ElementAccessor& element_accessor)
+{
+    element_accessor.object->Accept(*this);
+    element_accessor.index->Accept(*this);
+}
+
+void ReturnStatementPass::Visit(ArrayLiteral& array_literal)
+{
+    for (const auto& element : *array_literal.elements)
+    {
+        element->Accept(*this);
+    }
+}
+
+void ReturnStatementPass::Visit(Slicing& slicing)
+{
+    slicing.object->Accept(*this);
+    if (slicing.lower)
+    {
+        slicing.lower->Accept(*this);
+    }
+    if (slicing.upper)
+    {
+        slicing.upper->Accept(*this);
+    }
+}
+
 void ReturnStatementPass::Visit(StructExpression& struct_expression)
 {
     for (const auto& member_declaration : *struct_expression.members)
@@ -1,11 +1,16 @@
 #include "l0/semantics/semantics.h"
 
+#include "l0/semantics/bounds_check_elimination.h"
+#include "l0/semantics/const_evaluator.h"
+#include "l0/semantics/constant_folding.h"
 #include "l0/semantics/declare_global_types.h"
 #include "l0/semantics/declare_variables.h"
+#include "l0/semantics/escape_analysis.h"
 #include "l0/semantics/fill_types.h"
 #include "l0/semantics/reference_pass.h"
 #include "l0/semantics/resolver.h"
 #include "l0/semantics/return_statement_pass.h"
+#include "l0/semantics/struct_layout.h"
 #include "l0/semantics/typechecker.h"
 
 namespace l0
@@ -21,6 +26,11 @@ void FillGlobalTypes(Module& module)
     detail::FillTypeDetails(module);
 }
 
+void ReorderStructMembers(Module& module)
+{
+    detail::ReorderStructMembers(module);
+}
+
 void DeclareGlobalVariables(Module& module)
 {
     detail::DeclareGlobalVariables(module);
@@ -29,6 +39,7 @@ void DeclareGlobalVariables(Module& module)
 void BuildAndResolveLocalScopes(Module& module)
 {
     detail::Resolver{module}.Run();
+    module.are_local_scopes_resolved = true;
 }
 
 void CheckTypes(Module& module)
@@ -46,4 +57,24 @@ void CheckReferences(Module& module)
     detail::ReferencePass{module}.Run();
 }
 
+void EvaluateGlobalConstants(Module& module)
+{
+    detail::ConstEvaluator{module}.Run();
+}
+
+void FoldConstants(Module& module)
+{
+    detail::ConstantFolding{module}.Run();
+}
+
+void AnalyzeEscapes(Module& module)
+{
+    detail::EscapeAnalysis{module}.Run();
+}
+
+void EliminateBoundsChecks(Module& module)
+{
+    detail::BoundsCheckElimination{module}.Run();
+}
+
 }  // namespace l0
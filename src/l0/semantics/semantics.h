@@ -8,11 +8,16 @@ namespace l0
 
 void DeclareGlobalTypes(Module& module);
 void FillGlobalTypes(Module& module);
+void ReorderStructMembers(Module& module);
 void DeclareGlobalVariables(Module& module);
 void BuildAndResolveLocalScopes(Module& module);
 void CheckTypes(Module& module);
 void CheckReturnStatements(Module& module);
 void CheckReferences(Module& module);
+void EvaluateGlobalConstants(Module& module);
+void FoldConstants(Module& module);
+void AnalyzeEscapes(Module& module);
+void EliminateBoundsChecks(Module& module);
 
 }  // namespace l0
 
@@ -0,0 +1,138 @@
+#include "l0/semantics/struct_layout.h"
+
+#include <algorithm>
+#include <bit>
+#include <ranges>
+
+namespace l0::detail
+{
+
+namespace
+{
+
+class AlignmentVisitor : private IConstTypeVisitor
+{
+   public:
+    std::size_t GetAlignment(const Type& type)
+    {
+        type.Accept(*this);
+        return result_;
+    }
+
+   private:
+    std::size_t result_;
+
+    void Visit(const ReferenceType&) override
+    {
+        result_ = 8;
+    }
+
+    void Visit(const UnitType&) override
+    {
+        result_ = 1;
+    }
+
+    void Visit(const BooleanType&) override
+    {
+        result_ = 1;
+    }
+
+    void Visit(const IntegerType& integer_type) override
+    {
+        result_ = integer_type.width / 8;
+    }
+
+    void Visit(const FloatType& float_type) override
+    {
+        result_ = float_type.width / 8;
+    }
+
+    void Visit(const CharacterType&) override
+    {
+        result_ = 1;
+    }
+
+    void Visit(const ArrayType& array_type) override
+    {
+        result_ = AlignmentVisitor{}.GetAlignment(*array_type.element_type);
+    }
+
+    void Visit(const SliceType&) override
+    {
+        result_ = 8;
+    }
+
+    void Visit(const VectorType& vector_type) override
+    {
+        // vectors are aligned to their size rounded up to a power of two; masks take one bit per lane
+        auto size = dynamic_pointer_cast<BooleanType>(vector_type.element_type)
+                      ? (vector_type.lanes + 7) / 8
+                      : vector_type.lanes * AlignmentVisitor{}.GetAlignment(*vector_type.element_type);
+        result_ = std::bit_ceil(size);
+    }
+
+    void Visit(const FunctionType&) override
+    {
+        // Function values are closures consisting of two pointers.
+        result_ = 8;
+    }
+
+    void Visit(const StructType& struct_type) override
+    {
+        std::size_t alignment = 1;
+        for (const auto& member : *struct_type.members)
+        {
+            if (!member->is_static)
+            {
+                alignment = std::max(alignment, AlignmentVisitor{}.GetAlignment(*member->type));
+            }
+        }
+        result_ = struct_type.is_packed ? 1 : alignment;
+    }
+
+    void Visit(const EnumType& enum_type) override
+    {
+        result_ = enum_type.GetStorageWidth() / 8;
+    }
+};
+
+}  // namespace
+
+void ReorderStructMembers(Module& module)
+{
+    for (const auto& type_declaration : module.global_type_declarations)
+    {
+        // instances of generics may still be created after this pass, so all of them keep their declared layout
+        if (module.generic_instances.contains(type_declaration->identifier))
+        {
+            continue;
+        }
+        if (auto struct_type = dynamic_pointer_cast<StructType>(type_declaration->type))
+        {
+            ReorderStructMembers(*struct_type);
+        }
+    }
+}
+
+void ReorderStructMembers(StructType& type)
+{
+    if (type.is_packed)
+    {
+        return;
+    }
+
+    // Since all sizes are multiples of the respective alignment, ordering the members by decreasing alignment leaves
+    // no padding between them. Static members do not take part in the layout and are moved behind all others.
+    std::ranges::stable_sort(
+        *type.members,
+        std::ranges::greater{},
+        [](const auto& member) { return member->is_static ? 0 : GetNaturalAlignment(*member->type); }
+    );
+}
+
+std::size_t GetNaturalAlignment(const Type& type)
+{
+    return AlignmentVisitor{}.GetAlignment(type);
+}
+
+}  // namespace l0::detail
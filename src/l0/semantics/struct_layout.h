@@ -0,0 +1,19 @@
+#ifndef L0_SEMANTICS_STRUCT_LAYOUT_H
+#define L0_SEMANTICS_STRUCT_LAYOUT_H
+
+#include <cstddef>
+
+#include "l0/ast/module.h"
+#include "l0/types/types.h"
+
+namespace l0::detail
+{
+
+void ReorderStructMembers(Module& module);
+void ReorderStructMembers(StructType& type);
+
+std::size_t GetNaturalAlignment(const Type& type);
+
+}  // namespace l0::detail
+
+#endif
@@ -2,12 +2,13 @@
 
 #include <utility>
 
+#include "l0/semantics/generics.h"
 #include "l0/semantics/semantic_error.h"
 
 namespace l0::detail
 {
 
-TypeResolver::TypeResolver(const Module& module)
+TypeResolver::TypeResolver(Module& module)
     : module_{module}
 {
 }
@@ -90,11 +91,29 @@ std::shared_ptr<Type> TypeResolver::GetTypeByName(const Identifier& identifier,
 
 void TypeResolver::Visit(const SimpleTypeAnnotation& sta)
 {
-    auto type = GetTypeByName(sta.type_name, namespace_);
+    auto type = sta.type_arguments ? GetGenericInstance(sta) : GetTypeByName(sta.type_name, namespace_);
     auto mutability = Convert(sta.mutability);
     result_ = ModifyQualifier(*type, mutability);
 }
 
+std::shared_ptr<Type> TypeResolver::GetGenericInstance(const SimpleTypeAnnotation& sta)
+{
+    auto generic = ResolveGeneric(module_, sta.type_name, namespace_);
+    if (!generic || !std::holds_alternative<std::shared_ptr<TypeDeclaration>>(generic->definition))
+    {
+        throw SemanticError(std::format("Cannot resolve generic struct '{}'.", sta.type_name.ToString()));
+    }
+
+    std::vector<std::shared_ptr<Type>> type_arguments{};
+    for (const auto& argument : *sta.type_arguments)
+    {
+        argument->Accept(*this);
+        type_arguments.push_back(result_);
+    }
+
+    return GetTypeByName(Instantiate(module_, *generic, type_arguments), Identifier{});
+}
+
 void TypeResolver::Visit(const ReferenceTypeAnnotation& rta)
 {
     rta.base_type->Accept(*this);
@@ -104,6 +123,22 @@ void TypeResolver::Visit(const ReferenceTypeAnnotation& rta)
     result_ = reference_type;
 }
 
+void TypeResolver::Visit(const ArrayTypeAnnotation& ata)
+{
+    ata.element_type->Accept(*this);
+    auto element_type = result_;
+    auto mutability = Convert(ata.mutability);
+    result_ = std::make_shared<ArrayType>(element_type, ata.length, mutability);
+}
+
+void TypeResolver::Visit(const SliceTypeAnnotation& sta)
+{
+    sta.element_type->Accept(*this);
+    auto element_type = result_;
+    auto mutability = Convert(sta.mutability);
+    result_ = std::make_shared<SliceType>(element_type, mutability);
+}
+
 void TypeResolver::Visit(const FunctionTypeAnnotation& fta)
 {
     fta.return_type->Accept(*this);
@@ -14,7 +14,7 @@ namespace l0::detail
 class TypeResolver : private ITypeAnnotationVisitor
 {
    public:
-    TypeResolver(const Module& module);
+    TypeResolver(Module& module);
 
     std::shared_ptr<Type> Convert(const TypeAnnotation& annotation, Identifier namespace_);
     TypeQualifier Convert(TypeAnnotationQualifier qualifier);
@@ -23,14 +23,17 @@ class TypeResolver : private ITypeAnnotationVisitor
     std::pair<std::shared_ptr<Scope>, Identifier> Resolve(const Identifier& identifier, Identifier namespace_);
 
    private:
-    const Module& module_;
+    Module& module_;
     std::shared_ptr<Type> result_;
     Identifier namespace_;
 
     std::optional<std::shared_ptr<Scope>> Resolve(const Identifier& identifier);
+    std::shared_ptr<Type> GetGenericInstance(const SimpleTypeAnnotation& sta);
 
     void Visit(const SimpleTypeAnnotation& sta) override;
     void Visit(const ReferenceTypeAnnotation& rta) override;
+    void Visit(const ArrayTypeAnnotation& ata) override;
+    void Visit(const SliceTypeAnnotation& sta) override;
     void Visit(const FunctionTypeAnnotation& fta) override;
     void Visit(const MethodTypeAnnotation& mta) override;
     void Visit(const MutabilityOnlyTypeAnnotation& mota) override;
@@ -1,8 +1,13 @@
 #include "l0/semantics/typechecker.h"
 
+#include <algorithm>
+#include <limits>
+#include <map>
 #include <ranges>
 
 #include "l0/common/constants.h"
+#include "l0/semantics/const_evaluator.h"
+#include "l0/semantics/generics.h"
 #include "l0/semantics/semantic_error.h"
 
 namespace l0::detail
@@ -15,15 +20,18 @@ Typechecker::Typechecker(Module& module)
 
 void Typechecker::Run()
 {
-    for (auto global_declaration : module_.global_declarations)
+    // instances of generics are appended to the declarations while they are checked
+    for (std::size_t index = 0; index < module_.global_declarations.size(); ++index)
     {
+        auto global_declaration = module_.global_declarations.at(index);
         namespaces_.push(global_declaration->identifier.GetPrefix());
         CheckGlobalDeclaration(*global_declaration);
         namespaces_.pop();
     }
 
-    for (auto global_type_declaration : module_.global_type_declarations)
+    for (std::size_t index = 0; index < module_.global_type_declarations.size(); ++index)
     {
+        auto global_type_declaration = module_.global_type_declarations.at(index);
         auto type = global_type_declaration->type;
         if (auto struct_type = dynamic_pointer_cast<StructType>(type))
         {
@@ -52,6 +60,12 @@ void Typechecker::Visit(const Declaration& declaration)
     }
 
     declaration.initializer->Accept(*this);
+    if (declaration.annotation && !dynamic_pointer_cast<MutabilityOnlyTypeAnnotation>(declaration.annotation))
+    {
+        AdaptNumericLiteral(
+            *declaration.initializer, type_resolver_.Convert(*declaration.annotation, namespaces_.top())
+        );
+    }
 
     auto coerced_type =
         conversion_checker_.Coerce(declaration.annotation, declaration.initializer->type, namespaces_.top());
@@ -80,6 +94,10 @@ void Typechecker::Visit(const ExpressionStatement& expression_statement)
 void Typechecker::Visit(const ReturnStatement& return_statement)
 {
     return_statement.value->Accept(*this);
+    if (!return_types_.empty())
+    {
+        AdaptNumericLiteral(*return_statement.value, return_types_.top());
+    }
 }
 
 void Typechecker::Visit(const ConditionalStatement& conditional_statement)
@@ -102,6 +120,222 @@ void Typechecker::Visit(const ConditionalStatement& conditional_statement)
     }
 }
 
+void Typechecker::Visit(const MatchStatement& match_statement)
+{
+    match_statement.subject->Accept(*this);
+    auto subject_type = match_statement.subject->type;
+
+    if (!dynamic_pointer_cast<IntegerType>(subject_type) && !dynamic_pointer_cast<CharacterType>(subject_type)
+        && !dynamic_pointer_cast<BooleanType>(subject_type) && !dynamic_pointer_cast<EnumType>(subject_type))
+    {
+        throw SemanticError(std::format(
+            "Subject of match statement must be of integer, character, boolean or enum type, but is of type '{}'.",
+            subject_type->ToString()
+        ));
+    }
+
+    for (const auto& match_case : *match_statement.cases)
+    {
+        for (const auto& pattern : *match_case->patterns)
+        {
+            pattern->lower = GetPatternValue(*pattern->value, subject_type);
+            pattern->upper = pattern->lower;
+            if (!pattern->end)
+            {
+                continue;
+            }
+
+            if (!dynamic_pointer_cast<IntegerType>(subject_type) && !dynamic_pointer_cast<CharacterType>(subject_type))
+            {
+                throw SemanticError(std::format(
+                    "Range patterns require a subject of integer or character type, but it is of type '{}'.",
+                    subject_type->ToString()
+                ));
+            }
+            auto end = GetPatternValue(*pattern->end, subject_type, true);
+            if (end <= pattern->lower)
+            {
+                throw SemanticError(std::format("Range pattern '{}..{}' does not match any value.", pattern->lower, end));
+            }
+            pattern->upper = end - 1;
+        }
+
+        match_case->body->Accept(*this);
+    }
+
+    if (match_statement.else_block)
+    {
+        match_statement.else_block->Accept(*this);
+    }
+
+    CheckExhaustiveness(match_statement);
+}
+
+std::int64_t Typechecker::GetPatternValue(
+    const Expression& pattern, std::shared_ptr<Type> subject_type, bool is_range_end
+)
+{
+    pattern.Accept(*this);
+    AdaptNumericLiteral(pattern, subject_type);
+
+    auto mismatch = [&]
+    {
+        return SemanticError(std::format(
+            "Case pattern of type '{}' does not match subject of type '{}'.",
+            pattern.type->ToString(),
+            subject_type->ToString()
+        ));
+    };
+
+    // the exclusive end of a range may lie just beyond the maximum of a sized integer type, which is checked below
+    bool is_compatible = conversion_checker_.CheckCompatibility(subject_type, pattern.type);
+    auto integer_type = dynamic_pointer_cast<IntegerType>(subject_type);
+    if (!is_compatible && !(is_range_end && integer_type && dynamic_pointer_cast<IntegerType>(pattern.type)))
+    {
+        throw mismatch();
+    }
+
+    if (auto enum_type = dynamic_pointer_cast<EnumType>(subject_type))
+    {
+        auto variable = dynamic_cast<const Variable*>(&pattern);
+        auto index = variable ? enum_type->GetMemberIndex(variable->resolved_name) : std::nullopt;
+        if (!index)
+        {
+            throw SemanticError(
+                std::format("Case patterns over enum '{}' must be members of the enum.", enum_type->ToString())
+            );
+        }
+        return *index;
+    }
+
+    // negative integers are parsed as negations of literals
+    std::optional<ConstantValue> value{};
+    auto unary_op = dynamic_cast<const UnaryOp*>(&pattern);
+    if (unary_op && unary_op->overload == UnaryOp::Overload::IntegerNegation)
+    {
+        auto operand = GetLiteralValue(*unary_op->operand);
+        value = operand ? EvaluateUnaryOp(unary_op->overload, *operand) : std::nullopt;
+    }
+    else
+    {
+        value = GetLiteralValue(pattern);
+    }
+
+    auto ordinal = value ? GetOrdinal(*value) : std::nullopt;
+    if (!ordinal)
+    {
+        throw SemanticError("Case patterns must be literals or enum members.");
+    }
+    if (!is_compatible && !integer_type->CanRepresent(*ordinal - 1))
+    {
+        throw mismatch();
+    }
+    return *ordinal;
+}
+
+void Typechecker::CheckExhaustiveness(const MatchStatement& match_statement)
+{
+    auto subject_type = match_statement.subject->type;
+
+    std::vector<std::shared_ptr<MatchPattern>> patterns{};
+    for (const auto& match_case : *match_statement.cases)
+    {
+        patterns.insert(patterns.end(), match_case->patterns->begin(), match_case->patterns->end());
+    }
+    std::ranges::sort(patterns, {}, [](const auto& pattern) { return pattern->lower; });
+
+    for (std::size_t index = 1; index < patterns.size(); ++index)
+    {
+        if (patterns.at(index)->lower <= patterns.at(index - 1)->upper)
+        {
+            throw SemanticError(
+                std::format("Case patterns overlap at value {} in match statement.", patterns.at(index)->lower)
+            );
+        }
+    }
+
+    if (match_statement.else_block)
+    {
+        return;
+    }
+
+    std::int64_t min{std::numeric_limits<std::int64_t>::min()};
+    std::int64_t max{std::numeric_limits<std::int64_t>::max()};
+    auto enum_type = dynamic_pointer_cast<EnumType>(subject_type);
+    if (enum_type)
+    {
+        min = 0;
+        max = static_cast<std::int64_t>(enum_type->members->size()) - 1;
+    }
+    else if (dynamic_pointer_cast<BooleanType>(subject_type))
+    {
+        min = 0;
+        max = 1;
+    }
+    else if (dynamic_pointer_cast<CharacterType>(subject_type))
+    {
+        min = 0;
+        max = std::numeric_limits<std::uint8_t>::max();
+    }
+    else if (auto integer_type = dynamic_pointer_cast<IntegerType>(subject_type); integer_type->width < 64)
+    {
+        auto shift = integer_type->is_signed ? integer_type->width - 1 : integer_type->width;
+        min = integer_type->is_signed ? -(std::int64_t{1} << shift) : 0;
+        max = (std::int64_t{1} << shift) - 1;
+    }
+    else if (!integer_type->is_signed)
+    {
+        // values beyond the range of I64 cannot be written as patterns
+        throw SemanticError(std::format(
+            "Match statement over type '{}' is not exhaustive; add an 'else' case.", subject_type->ToString()
+        ));
+    }
+
+    // collect the values in [min, max] that are not matched by any pattern
+    std::vector<std::pair<std::int64_t, std::int64_t>> gaps{};
+    std::optional<std::int64_t> next_unmatched{min};
+    for (const auto& pattern : patterns)
+    {
+        if (next_unmatched && pattern->lower > *next_unmatched)
+        {
+            gaps.emplace_back(*next_unmatched, pattern->lower - 1);
+        }
+        next_unmatched = (pattern->upper < max) ? std::optional{pattern->upper + 1} : std::nullopt;
+    }
+    if (next_unmatched)
+    {
+        gaps.emplace_back(*next_unmatched, max);
+    }
+
+    if (gaps.empty())
+    {
+        return;
+    }
+
+    if (enum_type)
+    {
+        std::string missing_members{};
+        for (const auto& [first, last] : gaps)
+        {
+            for (auto index : std::views::iota(first, last + 1))
+            {
+                auto separator = missing_members.empty() ? "" : ", ";
+                missing_members += std::format("{}'{}'", separator, *enum_type->members->at(index));
+            }
+        }
+        throw SemanticError(std::format(
+            "Match statement over enum '{}' is not exhaustive, members {} are not matched.",
+            enum_type->ToString(),
+            missing_members
+        ));
+    }
+    throw SemanticError(std::format(
+        "Match statement over type '{}' is not exhaustive, e.g. value {} is not matched; add an 'else' case.",
+        subject_type->ToString(),
+        gaps.front().first
+    ));
+}
+
 void Typechecker::Visit(const WhileLoop& while_loop)
 {
     while_loop.condition->Accept(*this);
@@ -117,6 +351,28 @@ void Typechecker::Visit(const WhileLoop& while_loop)
     while_loop.body->Accept(*this);
 }
 
+void Typechecker::Visit(const ForLoop& for_loop)
+{
+    for_loop.begin->Accept(*this);
+    for_loop.end->Accept(*this);
+    AdaptNumericLiteral(*for_loop.end, for_loop.begin->type);
+    AdaptNumericLiteral(*for_loop.begin, for_loop.end->type);
+
+    auto begin_type = ModifyQualifier(*for_loop.begin->type, TypeQualifier::Constant);
+    auto end_type = ModifyQualifier(*for_loop.end->type, TypeQualifier::Constant);
+    if (!dynamic_pointer_cast<IntegerType>(begin_type) || *begin_type != *end_type)
+    {
+        throw SemanticError(std::format(
+            "Bounds of for loop must be integers of the same type, but are of types '{}' and '{}'.",
+            for_loop.begin->type->ToString(),
+            for_loop.end->type->ToString()
+        ));
+    }
+
+    for_loop.scope->SetVariableType(for_loop.variable, begin_type);
+    for_loop.body->Accept(*this);
+}
+
 void Typechecker::Visit(const Deallocation& deallocation)
 {
     deallocation.reference->Accept(*this);
@@ -149,6 +405,7 @@ void Typechecker::Visit(const Assignment& assignment)
     }
 
     assignment.expression->Accept(*this);
+    AdaptNumericLiteral(*assignment.expression, declared);
     auto assigned = assignment.expression->type;
 
     if (!conversion_checker_.CheckCompatibility(declared, assigned))
@@ -178,6 +435,9 @@ void Typechecker::Visit(const BinaryOp& binary_op)
     auto lhs = binary_op.left->type;
 
     binary_op.right->Accept(*this);
+    AdaptNumericLiteral(*binary_op.right, lhs);
+    AdaptNumericLiteral(*binary_op.left, binary_op.right->type);
+    lhs = binary_op.left->type;
     auto rhs = binary_op.right->type;
 
     auto resolution = operator_overload_resolver_.ResolveBinaryOperator(binary_op.op, lhs, rhs);
@@ -187,22 +447,71 @@ void Typechecker::Visit(const BinaryOp& binary_op)
 
 void Typechecker::Visit(const Variable& variable)
 {
+    if (!variable.scope)
+    {
+        if (!variable.type_arguments)
+        {
+            throw SemanticError(
+                std::format("Cannot infer the type arguments of generic function '{}'.", variable.name.ToString())
+            );
+        }
+        auto type_arguments = *variable.type_arguments
+                            | std::views::transform([this](const auto& argument)
+                                                    { return type_resolver_.Convert(*argument, namespaces_.top()); })
+                            | std::ranges::to<std::vector>();
+        InstantiateGenericFunction(variable, type_arguments);
+    }
+
     variable.type = variable.scope->GetVariableType(variable.resolved_name);
 }
 
 void Typechecker::Visit(const MemberAccessor& member_accessor)
 {
     member_accessor.object->Accept(*this);
-    std::shared_ptr<Type> dereferenced_object_type = member_accessor.object->type;
-    std::shared_ptr<Expression> dereferenced_object = member_accessor.object;
-    while (auto type_as_ref = dynamic_pointer_cast<ReferenceType>(dereferenced_object_type))
+    auto dereferenced_object = RemoveReferences(member_accessor.object);
+    auto dereferenced_object_type = dereferenced_object->type;
+
+    auto vector_type = dynamic_pointer_cast<VectorType>(dereferenced_object_type);
+    if (member_accessor.member == "len"
+        && (dynamic_pointer_cast<ArrayType>(dereferenced_object_type)
+            || dynamic_pointer_cast<SliceType>(dereferenced_object_type) || vector_type))
     {
-        dereferenced_object_type = type_as_ref->base_type;
+        member_accessor.dereferenced_object = dereferenced_object;
+        member_accessor.builtin_member = MemberAccessor::BuiltinMember::Length;
+        member_accessor.type = type_resolver_.GetTypeByName(Typename::Integer, Identifier{});
+        return;
+    }
 
-        auto new_dereferenced_object = std::make_shared<UnaryOp>(dereferenced_object, UnaryOp::Operator::Caret);
-        new_dereferenced_object->overload = UnaryOp::Overload::Dereferenciation;
-        new_dereferenced_object->type = dereferenced_object_type;
-        dereferenced_object = new_dereferenced_object;
+    if (vector_type)
+    {
+        // numeric vectors are reduced by sum, product, minimum and maximum, and masks by disjunction and conjunction
+        using BuiltinMember = MemberAccessor::BuiltinMember;
+        static const std::map<std::string, BuiltinMember> reductions{
+            {"sum", BuiltinMember::Sum},
+            {"product", BuiltinMember::Product},
+            {"min", BuiltinMember::Minimum},
+            {"max", BuiltinMember::Maximum},
+            {"any", BuiltinMember::Any},
+            {"all", BuiltinMember::All},
+        };
+
+        bool is_mask = dynamic_pointer_cast<BooleanType>(vector_type->element_type) != nullptr;
+        bool is_numeric = dynamic_pointer_cast<IntegerType>(vector_type->element_type)
+                       || dynamic_pointer_cast<FloatType>(vector_type->element_type);
+        auto reduction = reductions.find(member_accessor.member);
+        bool is_mask_reduction = reduction != reductions.end()
+                              && (reduction->second == BuiltinMember::Any || reduction->second == BuiltinMember::All);
+        if (reduction == reductions.end() || (is_mask_reduction ? !is_mask : !is_numeric))
+        {
+            throw SemanticError(std::format(
+                "Vectors of type '{}' have no member '{}'.", vector_type->ToString(), member_accessor.member
+            ));
+        }
+
+        member_accessor.dereferenced_object = dereferenced_object;
+        member_accessor.builtin_member = reduction->second;
+        member_accessor.type = vector_type->element_type;
+        return;
     }
 
     auto dereferenced_object_type_as_struct = dynamic_pointer_cast<StructType>(dereferenced_object_type);
@@ -243,6 +552,12 @@ void Typechecker::Visit(const MemberAccessor& member_accessor)
 
 void Typechecker::Visit(const Call& call)
 {
+    auto callee = dynamic_pointer_cast<Variable>(call.function);
+    if (callee && !callee->scope && !callee->type_arguments)
+    {
+        InferTypeArguments(call, *callee);
+    }
+
     call.function->Accept(*this);
 
     if (IsMethodCall(call))
@@ -271,6 +586,11 @@ void Typechecker::Visit(const IntegerLiteral& literal)
     literal.type = type_resolver_.GetTypeByName(Typename::Integer, Identifier{});
 }
 
+void Typechecker::Visit(const FloatLiteral& literal)
+{
+    literal.type = type_resolver_.GetTypeByName(Typename::Float64, Identifier{});
+}
+
 void Typechecker::Visit(const CharacterLiteral& literal)
 {
     literal.type = type_resolver_.GetTypeByName(Typename::Character, Identifier{});
@@ -303,7 +623,9 @@ void Typechecker::Visit(const Function& function)
     auto return_type = type_resolver_.Convert(*function.return_type_annotation, namespaces_.top());
     function.type = std::make_shared<FunctionType>(parameters, return_type, TypeQualifier::Constant);
 
+    return_types_.push(return_type);
     function.body->Accept(*this);
+    return_types_.pop();
 }
 
 void Typechecker::Visit(const Initializer& initializer)
@@ -344,6 +666,7 @@ void Typechecker::Visit(const Initializer& initializer)
         explicitely_initialized_members.insert(member_name);
 
         member_initializer->value->Accept(*this);
+        AdaptNumericLiteral(*member_initializer->value, member->type);
 
         if (!conversion_checker_.CheckCompatibility(member->type, member_initializer->value->type))
         {
@@ -392,6 +715,11 @@ void Typechecker::Visit(const Allocation& allocation)
     allocation.allocated_type = allocated_type;
     allocation.type = std::make_shared<ReferenceType>(allocation.allocated_type, TypeQualifier::Constant);
 
+    if (allocation.is_uninitialized)
+    {
+        return;
+    }
+
     if (allocation.member_initializers)
     {
         auto initializer = std::make_shared<Initializer>(allocation.annotation, allocation.member_initializers);
@@ -403,6 +731,276 @@ void Typechecker::Visit(const Allocation& allocation)
         allocation.initial_value->Accept(*this);
     }
     allocation.initial_value->Accept(*this);
+    AdaptNumericLiteral(*allocation.initial_value, allocated_type);
+}
+
+void Typechecker::Visit(const Conversion& conversion)
+{
+    conversion.operand->Accept(*this);
+    auto target = type_resolver_.Convert(*conversion.annotation, namespaces_.top());
+
+    // literals broadcast to a vector and array literals converted into one take the element type of the vector, e.g. in
+    // '0 as V4I32' and '[1, 2, 3, 4] as V4I32'
+    if (auto vector_type = dynamic_pointer_cast<VectorType>(target))
+    {
+        std::shared_ptr<Type> expected_type = dynamic_pointer_cast<ArrayLiteral>(conversion.operand)
+                               ? std::make_shared<ArrayType>(
+                                     vector_type->element_type, vector_type->lanes, TypeQualifier::Constant
+                                 )
+                               : vector_type->element_type;
+        AdaptNumericLiteral(*conversion.operand, expected_type);
+    }
+    auto source = conversion.operand->type;
+
+    if (!IsValidConversion(*source, *target))
+    {
+        throw SemanticError(std::format(
+            "Cannot convert value of type '{}' to type '{}'.", source->ToString(), target->ToString()
+        ));
+    }
+
+    conversion.type = ModifyQualifier(*target, TypeQualifier::Constant);
+}
+
+void Typechecker::Visit(const ElementAccessor& element_accessor)
+{
+    element_accessor.object->Accept(*this);
+    auto dereferenced_object = RemoveReferences(element_accessor.object);
+    auto dereferenced_object_type = dereferenced_object->type;
+
+    element_accessor.index->Accept(*this);
+
+    element_accessor.dereferenced_object = dereferenced_object;
+    element_accessor.dereferenced_object_type = dereferenced_object_type;
+
+    auto vector_type = dynamic_pointer_cast<VectorType>(dereferenced_object_type);
+    if (auto lanes = dynamic_pointer_cast<ArrayLiteral>(element_accessor.index); vector_type && lanes)
+    {
+        CheckShuffle(element_accessor, *vector_type, *lanes);
+        return;
+    }
+
+    CheckIndex(*element_accessor.index, "Index");
+
+    if (auto slice_type = dynamic_pointer_cast<SliceType>(dereferenced_object_type))
+    {
+        element_accessor.type = slice_type->element_type;
+        return;
+    }
+
+    std::shared_ptr<Type> element_type;
+    if (auto array_type = dynamic_pointer_cast<ArrayType>(dereferenced_object_type))
+    {
+        element_type = array_type->element_type;
+    }
+    else if (vector_type && !dynamic_pointer_cast<BooleanType>(vector_type->element_type))
+    {
+        element_type = vector_type->element_type;
+    }
+    else if (vector_type)
+    {
+        // masks are packed into one bit per lane, so their lanes have no address
+        throw SemanticError(std::format(
+            "Lanes of mask type '{}' cannot be accessed individually; convert it to an integer vector first.",
+            vector_type->ToString()
+        ));
+    }
+    else
+    {
+        throw SemanticError(std::format(
+            "Type of indexed object after removing references must be of array, slice or vector type, but is of type "
+            "'{}'.",
+            dereferenced_object_type->ToString()
+        ));
+    }
+
+    auto length = *GetFixedLength(*dereferenced_object_type);
+    auto literal = dynamic_pointer_cast<IntegerLiteral>(element_accessor.index);
+    if (literal && (literal->value < 0 || static_cast<std::size_t>(literal->value) >= length))
+    {
+        throw SemanticError(std::format(
+            "Index {} is out of range for value of type '{}'.", literal->value, dereferenced_object_type->ToString()
+        ));
+    }
+
+    element_accessor.type = ModifyQualifier(*element_type, dereferenced_object_type->mutability);
+}
+
+void Typechecker::CheckShuffle(
+    const ElementAccessor& element_accessor, const VectorType& vector_type, const ArrayLiteral& lanes
+) const
+{
+    std::vector<int> shuffle_mask{};
+    for (const auto& lane : *lanes.elements)
+    {
+        auto literal = dynamic_pointer_cast<IntegerLiteral>(lane);
+        if (!literal)
+        {
+            throw SemanticError("Lanes selected from a vector must be integer literals.");
+        }
+        if (literal->value < 0 || static_cast<std::size_t>(literal->value) >= vector_type.lanes)
+        {
+            throw SemanticError(std::format(
+                "Lane {} is out of range for vector of type '{}'.", literal->value, vector_type.ToString()
+            ));
+        }
+        shuffle_mask.push_back(static_cast<int>(literal->value));
+    }
+    if (lanes.repetitions)
+    {
+        shuffle_mask.resize(*lanes.repetitions, shuffle_mask.front());
+    }
+
+    element_accessor.shuffle_mask = shuffle_mask;
+    element_accessor.type =
+        std::make_shared<VectorType>(vector_type.element_type, shuffle_mask.size(), TypeQualifier::Constant);
+}
+
+void Typechecker::Visit(const Slicing& slicing)
+{
+    slicing.object->Accept(*this);
+    auto dereferenced_object = RemoveReferences(slicing.object);
+
+    if (slicing.lower)
+    {
+        slicing.lower->Accept(*this);
+        CheckIndex(*slicing.lower, "Lower bound of slice");
+    }
+    if (slicing.upper)
+    {
+        slicing.upper->Accept(*this);
+        CheckIndex(*slicing.upper, "Upper bound of slice");
+    }
+
+    std::shared_ptr<Type> element_type;
+    if (auto slice_type = dynamic_pointer_cast<SliceType>(dereferenced_object->type))
+    {
+        element_type = slice_type->element_type;
+    }
+    else if (auto array_type = dynamic_pointer_cast<ArrayType>(dereferenced_object->type))
+    {
+        element_type = ModifyQualifier(*array_type->element_type, array_type->mutability);
+    }
+    else if (dereferenced_object != slicing.object)
+    {
+        // slice the memory the innermost reference points to, which has no known length
+        dereferenced_object = dynamic_pointer_cast<UnaryOp>(dereferenced_object)->operand;
+        element_type = dynamic_pointer_cast<ReferenceType>(dereferenced_object->type)->base_type;
+        if (!slicing.lower || !slicing.upper)
+        {
+            throw SemanticError("Slices of references require both a lower and an upper bound.");
+        }
+    }
+    else
+    {
+        throw SemanticError(std::format(
+            "Sliced object must be of array, slice or reference type, but is of type '{}'.",
+            dereferenced_object->type->ToString()
+        ));
+    }
+
+    slicing.dereferenced_object = dereferenced_object;
+    slicing.dereferenced_object_type = dereferenced_object->type;
+    slicing.type = std::make_shared<SliceType>(element_type, TypeQualifier::Constant);
+}
+
+bool Typechecker::IsValidConversion(const Type& source, const Type& target) const
+{
+    auto source_vector = dynamic_cast<const VectorType*>(&source);
+    auto target_vector = dynamic_cast<const VectorType*>(&target);
+    auto source_array = dynamic_cast<const ArrayType*>(&source);
+    auto target_array = dynamic_cast<const ArrayType*>(&target);
+
+    // vectors are built from arrays of the same length and element type, or by broadcasting a scalar to all lanes, and
+    // converted lane-wise into vectors of the same length
+    if (target_vector)
+    {
+        if (source_array)
+        {
+            return source_array->length == target_vector->lanes
+                && *source_array->element_type == *target_vector->element_type;
+        }
+        if (source_vector)
+        {
+            return source_vector->lanes == target_vector->lanes
+                && (*source_vector->element_type == *target_vector->element_type
+                    || IsValidConversion(*source_vector->element_type, *target_vector->element_type));
+        }
+        return source == *target_vector->element_type || IsValidConversion(source, *target_vector->element_type);
+    }
+
+    // vectors are converted back into arrays, and masks into integers with one bit per lane, starting with the lowest
+    if (source_vector)
+    {
+        if (target_array)
+        {
+            return target_array->length == source_vector->lanes
+                && *target_array->element_type == *source_vector->element_type;
+        }
+        auto target_integer = dynamic_cast<const IntegerType*>(&target);
+        return dynamic_pointer_cast<BooleanType>(source_vector->element_type) && target_integer
+            && target_integer->width >= source_vector->lanes;
+    }
+
+    // floating-point numbers are only converted from and to integers and other floating-point numbers
+    if (dynamic_cast<const FloatType*>(&source) || dynamic_cast<const FloatType*>(&target))
+    {
+        return (dynamic_cast<const IntegerType*>(&source) || dynamic_cast<const FloatType*>(&source))
+            && (dynamic_cast<const IntegerType*>(&target) || dynamic_cast<const FloatType*>(&target));
+    }
+
+    bool is_valid_source = dynamic_cast<const IntegerType*>(&source) || dynamic_cast<const CharacterType*>(&source)
+                        || dynamic_cast<const BooleanType*>(&source) || dynamic_cast<const EnumType*>(&source);
+    bool is_valid_target = dynamic_cast<const IntegerType*>(&target) || dynamic_cast<const CharacterType*>(&target);
+    return is_valid_source && is_valid_target;
+}
+
+std::shared_ptr<Expression> Typechecker::RemoveReferences(std::shared_ptr<Expression> object) const
+{
+    std::shared_ptr<Expression> dereferenced_object = object;
+    while (auto type_as_ref = dynamic_pointer_cast<ReferenceType>(dereferenced_object->type))
+    {
+        auto new_dereferenced_object = std::make_shared<UnaryOp>(dereferenced_object, UnaryOp::Operator::Caret);
+        new_dereferenced_object->overload = UnaryOp::Overload::Dereferenciation;
+        new_dereferenced_object->type = type_as_ref->base_type;
+        dereferenced_object = new_dereferenced_object;
+    }
+    return dereferenced_object;
+}
+
+void Typechecker::CheckIndex(const Expression& index, const std::string& role) const
+{
+    if (!dynamic_pointer_cast<IntegerType>(index.type))
+    {
+        throw SemanticError(
+            std::format("{} must be of integer type, but is of type '{}'.", role, index.type->ToString())
+        );
+    }
+}
+
+void Typechecker::Visit(const ArrayLiteral& array_literal)
+{
+    const auto& elements = *array_literal.elements;
+    for (const auto& element : elements)
+    {
+        element->Accept(*this);
+    }
+
+    auto element_type = ModifyQualifier(*elements.front()->type, TypeQualifier::Constant);
+    for (const auto& element : elements | std::views::drop(1))
+    {
+        AdaptNumericLiteral(*element, element_type);
+        if (*element->type != *element_type)
+        {
+            throw SemanticError(std::format(
+                "Elements of array literal must have the same type, but '{}' and '{}' are given.",
+                element_type->ToString(),
+                element->type->ToString()
+            ));
+        }
+    }
+
+    array_literal.type = std::make_shared<ArrayType>(element_type, array_literal.GetLength(), TypeQualifier::Constant);
 }
 
 std::shared_ptr<Expression> Typechecker::GetInitialValue(std::shared_ptr<Type> type) const
@@ -419,19 +1017,103 @@ std::shared_ptr<Expression> Typechecker::GetInitialValue(std::shared_ptr<Type> t
     {
         return std::make_shared<IntegerLiteral>(0);
     }
+    if (dynamic_pointer_cast<FloatType>(type))
+    {
+        return std::make_shared<FloatLiteral>(0.0);
+    }
     if (dynamic_pointer_cast<CharacterType>(type))
     {
         return std::make_shared<CharacterLiteral>('\0');
     }
+    if (auto array_type = dynamic_pointer_cast<ArrayType>(type))
+    {
+        auto elements = std::make_shared<ArgumentList>();
+        elements->push_back(GetInitialValue(array_type->element_type));
+        return std::make_shared<ArrayLiteral>(elements, array_type->length);
+    }
 
     throw SemanticError(std::format("Cannot create initial value of type '{}'.", type->ToString()));
 }
 
+void Typechecker::AdaptNumericLiteral(const Expression& expression, std::shared_ptr<Type> target) const
+{
+    // Integer literals are of type I64 by default, but take the integer type expected by their context if their
+    // value is in its range. Floating-point literals are of type F64 by default and are rounded to F32 if expected.
+    // The elements of array literals are adapted to the element type of an expected array.
+    if (auto array_type = dynamic_pointer_cast<ArrayType>(target))
+    {
+        auto array_literal = dynamic_cast<const ArrayLiteral*>(&expression);
+        if (!array_literal)
+        {
+            return;
+        }
+
+        const auto& elements = *array_literal->elements;
+        for (const auto& element : elements)
+        {
+            AdaptNumericLiteral(*element, array_type->element_type);
+        }
+
+        auto element_type = ModifyQualifier(*elements.front()->type, TypeQualifier::Constant);
+        if (std::ranges::all_of(elements, [&](const auto& element) { return *element->type == *element_type; }))
+        {
+            array_literal->type =
+                std::make_shared<ArrayType>(element_type, array_literal->GetLength(), TypeQualifier::Constant);
+        }
+        return;
+    }
+
+    if (auto float_type = dynamic_pointer_cast<FloatType>(target))
+    {
+        auto adapted_type = ModifyQualifier(*float_type, TypeQualifier::Constant);
+        auto unary_op = dynamic_cast<const UnaryOp*>(&expression);
+        bool is_negation = unary_op && unary_op->overload == UnaryOp::Overload::FloatNegation;
+        if (auto literal = dynamic_cast<const FloatLiteral*>(is_negation ? unary_op->operand.get() : &expression))
+        {
+            literal->type = adapted_type;
+            if (is_negation)
+            {
+                unary_op->type = adapted_type;
+            }
+        }
+        return;
+    }
+
+    auto integer_type = dynamic_pointer_cast<IntegerType>(target);
+    if (!integer_type)
+    {
+        return;
+    }
+    auto adapted_type = ModifyQualifier(*integer_type, TypeQualifier::Constant);
+
+    if (auto literal = dynamic_cast<const IntegerLiteral*>(&expression))
+    {
+        if (integer_type->CanRepresent(literal->value))
+        {
+            literal->type = adapted_type;
+        }
+        return;
+    }
+
+    // negative integers are parsed as negations of literals
+    auto unary_op = dynamic_cast<const UnaryOp*>(&expression);
+    if (!unary_op || unary_op->overload != UnaryOp::Overload::IntegerNegation || !integer_type->is_signed)
+    {
+        return;
+    }
+    auto literal = dynamic_cast<const IntegerLiteral*>(unary_op->operand.get());
+    if (literal && integer_type->CanRepresent(-literal->value))
+    {
+        literal->type = adapted_type;
+        unary_op->type = adapted_type;
+    }
+}
+
 bool Typechecker::IsMethodCall(const Call& call) const
 {
     auto member_accessor = dynamic_pointer_cast<MemberAccessor>(call.function);
 
-    if (!member_accessor)
+    if (!member_accessor || member_accessor->builtin_member)
     {
         return false;
     }
@@ -450,6 +1132,10 @@ void Typechecker::CheckFunctionCall(const Call& call)
     auto parameter_types = std::views::all(*function_type->parameters);
 
     std::ranges::for_each(*call.arguments, [&](auto argument) { argument->Accept(*this); });
+    for (std::size_t index = 0; index < call.arguments->size() && index < parameter_types.size(); ++index)
+    {
+        AdaptNumericLiteral(*call.arguments->at(index), parameter_types[index]);
+    }
     auto argument_types = *call.arguments | std::views::transform([](auto argument) { return argument->type; });
 
     if (parameter_types.size() != argument_types.size())
@@ -492,6 +1178,10 @@ void Typechecker::CheckMethodCall(const Call& call)
     argument_types.push_back(std::make_shared<ReferenceType>(this_type, TypeQualifier::Mutable));
 
     std::ranges::for_each(*call.arguments, [&](auto argument) { argument->Accept(*this); });
+    for (std::size_t index = 0; index < call.arguments->size() && index + 1 < parameter_types.size(); ++index)
+    {
+        AdaptNumericLiteral(*call.arguments->at(index), parameter_types[index + 1]);
+    }
     auto explicit_arguments = *call.arguments | std::views::transform([](auto argument) { return argument->type; })
                             | std::ranges::to<std::vector>();
     argument_types.insert(argument_types.end(), explicit_arguments.begin(), explicit_arguments.end());
@@ -521,12 +1211,51 @@ void Typechecker::CheckMethodCall(const Call& call)
     call.type = function_type->return_type;
 }
 
+void Typechecker::InferTypeArguments(const Call& call, const Variable& callee)
+{
+    auto generic = GetGenericFunction(callee);
+
+    std::ranges::for_each(*call.arguments, [&](auto argument) { argument->Accept(*this); });
+    auto type_arguments = detail::InferTypeArguments(module_, *generic, *call.arguments);
+
+    for (const auto& [parameter, argument] : std::views::zip(generic->type_parameters, type_arguments))
+    {
+        if (!argument)
+        {
+            throw SemanticError(std::format(
+                "Cannot infer type argument '{}' of generic function '{}'.", parameter, callee.name.ToString()
+            ));
+        }
+    }
+
+    InstantiateGenericFunction(callee, type_arguments);
+}
+
+void Typechecker::InstantiateGenericFunction(
+    const Variable& variable, const std::vector<std::shared_ptr<Type>>& type_arguments
+)
+{
+    auto generic = GetGenericFunction(variable);
+    variable.resolved_name = Instantiate(module_, *generic, type_arguments);
+    variable.scope = module_.globals;
+}
+
+std::shared_ptr<GenericDeclaration> Typechecker::GetGenericFunction(const Variable& variable) const
+{
+    auto generic = ResolveGeneric(module_, variable.name, namespaces_.top());
+    if (!generic || !std::holds_alternative<std::shared_ptr<Declaration>>(generic->definition))
+    {
+        throw SemanticError(std::format("Cannot resolve generic function '{}'.", variable.name.ToString()));
+    }
+    return generic;
+}
+
 void Typechecker::CheckGlobalDeclaration(const Declaration& declaration)
 {
     declaration.initializer->Accept(*this);
-    auto initializer_type = declaration.initializer->type;
-
     auto declared_type = module_.globals->GetVariableType(declaration.identifier);
+    AdaptNumericLiteral(*declaration.initializer, declared_type);
+    auto initializer_type = declaration.initializer->type;
 
     if (!conversion_checker_.CheckCompatibility(declared_type, initializer_type))
     {
@@ -549,6 +1278,7 @@ void Typechecker::CheckStruct(const StructType& struct_type)
         }
 
         member->default_initializer->Accept(*this);
+        AdaptNumericLiteral(*member->default_initializer, member->type);
         auto annotated_type = member->type;
         auto initializer_type = member->default_initializer->type;
 
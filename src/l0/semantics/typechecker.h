@@ -1,6 +1,7 @@
 #ifndef L0_SEMANTICS_TYPECHECKER_H
 #define L0_SEMANTICS_TYPECHECKER_H
 
+#include <cstdint>
 #include <memory>
 #include <stack>
 
@@ -29,6 +30,7 @@ class Typechecker : private IConstExpressionVisitor, private IConstStatementVisi
     detail::ConversionChecker conversion_checker_{type_resolver_};
 
     std::stack<Identifier> namespaces_{};
+    std::stack<std::shared_ptr<Type>> return_types_{};
 
     void Visit(const StatementBlock& statement_block) override;
     void Visit(const Declaration& declaration) override;
@@ -36,7 +38,9 @@ class Typechecker : private IConstExpressionVisitor, private IConstStatementVisi
     void Visit(const ExpressionStatement& expression_statement) override;
     void Visit(const ReturnStatement& return_statement) override;
     void Visit(const ConditionalStatement& conditional_statement) override;
+    void Visit(const MatchStatement& match_statement) override;
     void Visit(const WhileLoop& while_loop) override;
+    void Visit(const ForLoop& for_loop) override;
     void Visit(const Deallocation& declaration) override;
 
     void Visit(const Assignment& assignment) override;
@@ -48,17 +52,37 @@ class Typechecker : private IConstExpressionVisitor, private IConstStatementVisi
     void Visit(const UnitLiteral& literal) override;
     void Visit(const BooleanLiteral& literal) override;
     void Visit(const IntegerLiteral& literal) override;
+    void Visit(const FloatLiteral& literal) override;
     void Visit(const CharacterLiteral& literal) override;
     void Visit(const StringLiteral& literal) override;
     void Visit(const Function& function) override;
     void Visit(const Initializer& initializer) override;
     void Visit(const Allocation& allocation) override;
+    void Visit(const Conversion& conversion) override;
+    void Visit(const ElementAccessor& element_accessor) override;
+    void Visit(const ArrayLiteral& array_literal) override;
+    void Visit(const Slicing& slicing) override;
 
     std::shared_ptr<Expression> GetInitialValue(std::shared_ptr<Type> type) const;
+    std::shared_ptr<Expression> RemoveReferences(std::shared_ptr<Expression> object) const;
+    void CheckIndex(const Expression& index, const std::string& role) const;
+    bool IsValidConversion(const Type& source, const Type& target) const;
+    void CheckShuffle(
+        const ElementAccessor& element_accessor, const VectorType& vector_type, const ArrayLiteral& lanes
+    ) const;
+    void AdaptNumericLiteral(const Expression& expression, std::shared_ptr<Type> target) const;
 
     bool IsMethodCall(const Call& call) const;
     void CheckFunctionCall(const Call& call);
     void CheckMethodCall(const Call& call);
+    void InferTypeArguments(const Call& call, const Variable& callee);
+    void InstantiateGenericFunction(const Variable& variable, const std::vector<std::shared_ptr<Type>>& type_arguments);
+    std::shared_ptr<GenericDeclaration> GetGenericFunction(const Variable& variable) const;
+
+    std::int64_t GetPatternValue(
+        const Expression& pattern, std::shared_ptr<Type> subject_type, bool is_range_end = false
+    );
+    void CheckExhaustiveness(const MatchStatement& match_statement);
 
     void CheckGlobalDeclaration(const Declaration& declaration);
     void CheckStruct(const StructType& struct_type);
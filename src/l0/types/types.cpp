@@ -1,7 +1,9 @@
 #include "l0/types/types.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <format>
+#include <limits>
 #include <ranges>
 #include <sstream>
 
@@ -94,14 +96,16 @@ bool BooleanType::Equals(const Type&) const
     return true;
 }
 
-IntegerType::IntegerType(TypeQualifier mutability)
-    : Type{mutability}
+IntegerType::IntegerType(TypeQualifier mutability, unsigned width, bool is_signed)
+    : Type{mutability},
+      width{width},
+      is_signed{is_signed}
 {
 }
 
 std::string IntegerType::ToString() const
 {
-    return std::format("{}{}", str(mutability), Typename::Integer);
+    return std::format("{}{}{}", str(mutability), is_signed ? 'I' : 'U', width);
 }
 
 void IntegerType::Accept(IConstTypeVisitor& visitor) const
@@ -109,9 +113,48 @@ void IntegerType::Accept(IConstTypeVisitor& visitor) const
     visitor.Visit(*this);
 }
 
-bool IntegerType::Equals(const Type&) const
+bool IntegerType::CanRepresent(std::int64_t value) const
 {
-    return true;
+    if (width == 64)
+    {
+        return is_signed || value >= 0;
+    }
+    if (is_signed)
+    {
+        auto bound = std::int64_t{1} << (width - 1);
+        return -bound <= value && value < bound;
+    }
+    return 0 <= value && value < (std::int64_t{1} << width);
+}
+
+bool IntegerType::Equals(const Type& other) const
+{
+    const IntegerType* real_other = static_cast<const IntegerType*>(&other);
+
+    return this->width == real_other->width && this->is_signed == real_other->is_signed;
+}
+
+FloatType::FloatType(TypeQualifier mutability, unsigned width)
+    : Type{mutability},
+      width{width}
+{
+}
+
+std::string FloatType::ToString() const
+{
+    return std::format("{}F{}", str(mutability), width);
+}
+
+void FloatType::Accept(IConstTypeVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
+bool FloatType::Equals(const Type& other) const
+{
+    const FloatType* real_other = static_cast<const FloatType*>(&other);
+
+    return this->width == real_other->width;
 }
 
 CharacterType::CharacterType(TypeQualifier mutability)
@@ -134,6 +177,77 @@ bool CharacterType::Equals(const Type&) const
     return true;
 }
 
+ArrayType::ArrayType(std::shared_ptr<Type> element_type, std::size_t length, TypeQualifier mutability)
+    : Type{mutability},
+      element_type{element_type},
+      length{length}
+{
+}
+
+std::string ArrayType::ToString() const
+{
+    return std::format("{}[{}]{}", str(mutability), length, element_type->ToString());
+}
+
+void ArrayType::Accept(IConstTypeVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
+bool ArrayType::Equals(const Type& other) const
+{
+    const ArrayType* real_other = static_cast<const ArrayType*>(&other);
+
+    return this->length == real_other->length && *this->element_type == *real_other->element_type;
+}
+
+SliceType::SliceType(std::shared_ptr<Type> element_type, TypeQualifier mutability)
+    : Type{mutability},
+      element_type{element_type}
+{
+}
+
+std::string SliceType::ToString() const
+{
+    return std::format("{}[]{}", str(mutability), element_type->ToString());
+}
+
+void SliceType::Accept(IConstTypeVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
+bool SliceType::Equals(const Type& other) const
+{
+    const SliceType* real_other = static_cast<const SliceType*>(&other);
+
+    return *this->element_type == *real_other->element_type;
+}
+
+VectorType::VectorType(std::shared_ptr<Type> element_type, std::size_t lanes, TypeQualifier mutability)
+    : Type{mutability},
+      element_type{element_type},
+      lanes{lanes}
+{
+}
+
+std::string VectorType::ToString() const
+{
+    return std::format("{}V{}{}", str(mutability), lanes, element_type->ToString());
+}
+
+void VectorType::Accept(IConstTypeVisitor& visitor) const
+{
+    visitor.Visit(*this);
+}
+
+bool VectorType::Equals(const Type& other) const
+{
+    const VectorType* real_other = static_cast<const VectorType*>(&other);
+
+    return this->lanes == real_other->lanes && *this->element_type == *real_other->element_type;
+}
+
 FunctionType::FunctionType(
     std::shared_ptr<ParameterList> parameters, std::shared_ptr<Type> return_type, TypeQualifier mutability
 )
@@ -240,6 +354,33 @@ void EnumType::Accept(IConstTypeVisitor& visitor) const
     visitor.Visit(*this);
 }
 
+std::optional<std::size_t> EnumType::GetMemberIndex(const Identifier& qualified_name) const
+{
+    auto member_it = std::ranges::find_if(
+        *members, [&](const auto& member) { return identifier + *member == qualified_name; }
+    );
+
+    if (member_it == members->end())
+    {
+        return {};
+    }
+
+    return std::distance(members->begin(), member_it);
+}
+
+unsigned EnumType::GetStorageWidth() const
+{
+    if (members->size() <= std::size_t{std::numeric_limits<std::uint8_t>::max()} + 1)
+    {
+        return 8;
+    }
+    if (members->size() <= std::size_t{std::numeric_limits<std::uint16_t>::max()} + 1)
+    {
+        return 16;
+    }
+    return 32;
+}
+
 bool EnumType::Equals(const Type& other) const
 {
     const EnumType* real_other = static_cast<const EnumType*>(&other);
@@ -280,9 +421,14 @@ class ModifyQualifierVisitor : private IConstTypeVisitor
         result_ = std::make_shared<BooleanType>(qualifier_);
     }
 
-    void Visit(const IntegerType&)
+    void Visit(const IntegerType& integer_type)
     {
-        result_ = std::make_shared<IntegerType>(qualifier_);
+        result_ = std::make_shared<IntegerType>(qualifier_, integer_type.width, integer_type.is_signed);
+    }
+
+    void Visit(const FloatType& float_type)
+    {
+        result_ = std::make_shared<FloatType>(qualifier_, float_type.width);
     }
 
     void Visit(const CharacterType&)
@@ -290,6 +436,21 @@ class ModifyQualifierVisitor : private IConstTypeVisitor
         result_ = std::make_shared<CharacterType>(qualifier_);
     }
 
+    void Visit(const ArrayType& array_type)
+    {
+        result_ = std::make_shared<ArrayType>(array_type.element_type, array_type.length, qualifier_);
+    }
+
+    void Visit(const SliceType& slice_type)
+    {
+        result_ = std::make_shared<SliceType>(slice_type.element_type, qualifier_);
+    }
+
+    void Visit(const VectorType& vector_type)
+    {
+        result_ = std::make_shared<VectorType>(vector_type.element_type, vector_type.lanes, qualifier_);
+    }
+
     void Visit(const FunctionType& function_type)
     {
         result_ = std::make_shared<FunctionType>(function_type.parameters, function_type.return_type, qualifier_);
@@ -297,7 +458,9 @@ class ModifyQualifierVisitor : private IConstTypeVisitor
 
     void Visit(const StructType& struct_type)
     {
-        result_ = std::make_shared<StructType>(struct_type.identifier, struct_type.members, qualifier_);
+        auto result = std::make_shared<StructType>(struct_type.identifier, struct_type.members, qualifier_);
+        result->is_packed = struct_type.is_packed;
+        result_ = result;
     }
 
     void Visit(const EnumType& enum_type)
@@ -313,4 +476,17 @@ std::shared_ptr<Type> ModifyQualifier(const Type& type, TypeQualifier qualifier)
     return ModifyQualifierVisitor{}.ChangeQualifier(type, qualifier);
 }
 
+std::optional<std::size_t> GetFixedLength(const Type& type)
+{
+    if (auto array_type = dynamic_cast<const ArrayType*>(&type))
+    {
+        return array_type->length;
+    }
+    if (auto vector_type = dynamic_cast<const VectorType*>(&type))
+    {
+        return vector_type->lanes;
+    }
+    return std::nullopt;
+}
+
 }  // namespace l0
@@ -3,7 +3,9 @@
 
 #include <llvm/IR/Attributes.h>
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -82,12 +84,32 @@ class BooleanType : public Type
 class IntegerType : public Type
 {
    public:
-    IntegerType(TypeQualifier mutability);
+    IntegerType(TypeQualifier mutability, unsigned width = 64, bool is_signed = true);
 
     std::string ToString() const override;
 
     void Accept(IConstTypeVisitor& visitor) const override;
 
+    const unsigned width;
+    const bool is_signed;
+
+    bool CanRepresent(std::int64_t value) const;
+
+   protected:
+    bool Equals(const Type& other) const override;
+};
+
+class FloatType : public Type
+{
+   public:
+    FloatType(TypeQualifier mutability, unsigned width = 64);
+
+    std::string ToString() const override;
+
+    void Accept(IConstTypeVisitor& visitor) const override;
+
+    const unsigned width;
+
    protected:
     bool Equals(const Type& other) const override;
 };
@@ -105,6 +127,58 @@ class CharacterType : public Type
     bool Equals(const Type& other) const override;
 };
 
+// Arrays of a fixed length are values; their elements are mutable exactly if the array is.
+class ArrayType : public Type
+{
+   public:
+    ArrayType(std::shared_ptr<Type> element_type, std::size_t length, TypeQualifier mutability);
+
+    std::string ToString() const override;
+
+    void Accept(IConstTypeVisitor& visitor) const override;
+
+    const std::shared_ptr<Type> element_type;
+    const std::size_t length;
+
+   protected:
+    bool Equals(const Type& other) const override;
+};
+
+// Slices refer to a sequence of elements stored elsewhere, by a pointer to the first element and the number of
+// elements. Like for references, the mutability of the elements is independent of that of the slice.
+class SliceType : public Type
+{
+   public:
+    SliceType(std::shared_ptr<Type> element_type, TypeQualifier mutability);
+
+    std::string ToString() const override;
+
+    void Accept(IConstTypeVisitor& visitor) const override;
+
+    const std::shared_ptr<Type> element_type;
+
+   protected:
+    bool Equals(const Type& other) const override;
+};
+
+// SIMD vectors of a fixed number of lanes of a scalar type; operators apply lane-wise. Vectors of booleans are the
+// masks resulting from lane-wise comparisons. Like for arrays, lanes are mutable exactly if the vector is.
+class VectorType : public Type
+{
+   public:
+    VectorType(std::shared_ptr<Type> element_type, std::size_t lanes, TypeQualifier mutability);
+
+    std::string ToString() const override;
+
+    void Accept(IConstTypeVisitor& visitor) const override;
+
+    const std::shared_ptr<Type> element_type;
+    const std::size_t lanes;
+
+   protected:
+    bool Equals(const Type& other) const override;
+};
+
 using ParameterList = const std::vector<std::shared_ptr<Type>>;
 
 class FunctionType : public Type
@@ -152,6 +226,7 @@ class StructType : public Type
 
     const Identifier identifier;
     std::shared_ptr<StructMemberList> members;
+    bool is_packed{false};
 
     bool HasMember(std::string name) const;
     std::shared_ptr<StructMember> GetMember(std::string name) const;
@@ -176,6 +251,12 @@ class EnumType : public Type
     const Identifier identifier;
     std::shared_ptr<EnumMemberList> members;
 
+    // Index of the member with the given fully qualified name (e.g. 'Color::Red'), which is also its value
+    std::optional<std::size_t> GetMemberIndex(const Identifier& qualified_name) const;
+
+    // Number of bits of the smallest integer type (i8, i16 or i32) that can hold the index of each member
+    unsigned GetStorageWidth() const;
+
    protected:
     bool Equals(const Type& other) const override;
 };
@@ -189,7 +270,11 @@ class IConstTypeVisitor
     virtual void Visit(const UnitType& unit_type) = 0;
     virtual void Visit(const BooleanType& boolean_type) = 0;
     virtual void Visit(const IntegerType& integer_type) = 0;
+    virtual void Visit(const FloatType& float_type) = 0;
     virtual void Visit(const CharacterType& integer_type) = 0;
+    virtual void Visit(const ArrayType& array_type) = 0;
+    virtual void Visit(const SliceType& slice_type) = 0;
+    virtual void Visit(const VectorType& vector_type) = 0;
     virtual void Visit(const FunctionType& function_type) = 0;
     virtual void Visit(const StructType& struct_type) = 0;
     virtual void Visit(const EnumType& struct_type) = 0;
@@ -197,6 +282,9 @@ class IConstTypeVisitor
 
 std::shared_ptr<Type> ModifyQualifier(const Type& type, TypeQualifier qualifier);
 
+// The number of elements of arrays and lanes of vectors, which is part of their type; empty for other types
+std::optional<std::size_t> GetFixedLength(const Type& type);
+
 }  // namespace l0
 
 #endif